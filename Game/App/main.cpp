@@ -6,8 +6,8 @@
 
 #include "Game.h"
 
-int main()
+int main(int argc, char* argv[])
 {
-    FA::Game game;
+    FA::Game game(FA::ParseGameOptions(argc, argv));
     return game.Run();
 }
@@ -0,0 +1,74 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <memory>
+
+#include <gmock/gmock.h>
+
+#include "Animation/Animation.h"
+#include "Animation/ImageTraits.h"
+#include "Benchmark.h"
+#include "Resource/ImageFrame.h"
+#include "Sequence.h"
+#include "SpriteMock.h"
+#include "TextureMock.h"
+
+using namespace testing;
+
+namespace FA {
+
+namespace Shared {
+
+namespace {
+
+constexpr float frameTime = 1.0f / 120.0f;
+constexpr float switchTime = 0.1f;
+constexpr int nFrames = 8;
+
+std::shared_ptr<Sequence<ImageFrame>> CreateSequence(const Graphic::TextureIf& texture)
+{
+    auto seq = std::make_shared<Sequence<ImageFrame>>(switchTime);
+    for (int i = 0; i < nFrames; i++) {
+        seq->Add({&texture, sf::IntRect(i * 16, 0, 16, 16), {8.0f, 8.0f}});
+    }
+    seq->Start();
+
+    return seq;
+}
+
+void Sequence_Update(Benchmark::State& state)
+{
+    NiceMock<Graphic::TextureMock> texture;
+    auto seq = CreateSequence(texture);
+
+    for (auto _ : state) {
+        seq->Update(frameTime);
+        Benchmark::DoNotOptimize(seq->GetCurrent());
+    }
+    state.SetItemsProcessed(state.Iterations());
+}
+
+void Animation_UpdateAndApplyTo(Benchmark::State& state)
+{
+    NiceMock<Graphic::TextureMock> texture;
+    NiceMock<Graphic::SpriteMock> sprite;
+    Animation<ImageFrame> animation(CreateSequence(texture));
+
+    for (auto _ : state) {
+        animation.Update(frameTime);
+        animation.ApplyTo(sprite);
+    }
+    state.SetItemsProcessed(state.Iterations());
+}
+
+}  // namespace
+
+BENCHMARK(Sequence_Update);
+BENCHMARK(Animation_UpdateAndApplyTo);
+
+}  // namespace Shared
+
+}  // namespace FA
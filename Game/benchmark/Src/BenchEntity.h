@@ -0,0 +1,56 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <SFML/Graphics/Rect.hpp>
+
+#include "EntityIf.h"
+
+namespace FA {
+
+namespace Entity {
+
+// Minimal entity with a collision box. EntityMock would spend most of the measured time in gmock when
+// called from the inner collision loops.
+class BenchEntity : public EntityIf
+{
+public:
+    BenchEntity(EntityId id, const sf::FloatRect& rect, bool isStatic)
+        : id_(id)
+        , rect_(rect)
+        , isStatic_(isStatic)
+    {}
+
+    virtual EntityType Type() const override { return isStatic_ ? EntityType::Rect : EntityType::Mole; }
+    virtual LayerType GetLayer() const override { return LayerType::Ground; }
+    virtual bool IsStatic() const override { return isStatic_; }
+    virtual bool IsSolid() const override { return isStatic_; }
+    virtual void Destroy() override {}
+    virtual void Init() override {}
+    virtual void Update(float deltaTime) override {}
+    virtual void Interpolate(float alpha) override {}
+    virtual void DrawTo(Graphic::RenderTargetIf& renderTarget) const override {}
+    virtual sf::FloatRect GetDrawBounds() const override { return rect_; }
+    virtual bool Intersect(const EntityIf& otherEntity) const override
+    {
+        return rect_.intersects(static_cast<const BenchEntity&>(otherEntity).rect_);
+    }
+    virtual bool IsOutsideTileMap(const sf::FloatRect& rect) const override { return !rect.intersects(rect_); }
+    virtual void HandleCollision(const EntityId id) override { nCollisions_++; }
+    virtual void HandleOutsideTileMap() override {}
+    virtual EntityId GetId() const override { return id_; }
+
+private:
+    EntityId id_{};
+    sf::FloatRect rect_;
+    bool isStatic_ = false;
+    unsigned int nCollisions_{};
+};
+
+}  // namespace Entity
+
+}  // namespace FA
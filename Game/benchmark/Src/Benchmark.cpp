@@ -0,0 +1,241 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <unordered_map>
+
+#include "FrameMetrics.h"
+
+namespace FA {
+
+namespace Benchmark {
+
+namespace {
+
+struct Entry
+{
+    std::string name_;
+    BenchmarkFn fn_;
+    std::vector<long long> args_;
+};
+
+struct Result
+{
+    std::string name_;
+    std::size_t nIterations_{};
+    double nsPerIteration_{};
+    double itemsPerSecond_{};
+};
+
+std::vector<Entry>& Entries()
+{
+    static std::vector<Entry> entries;
+    return entries;
+}
+
+std::unordered_map<std::string, std::string>& Options()
+{
+    static std::unordered_map<std::string, std::string> options;
+    return options;
+}
+
+void ParseOptions(int argc, char* argv[])
+{
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg.compare(0, 2, "--") != 0) continue;
+        auto pos = arg.find('=');
+        auto name = arg.substr(2, pos == std::string::npos ? std::string::npos : pos - 2);
+        auto value = pos == std::string::npos ? "" : arg.substr(pos + 1);
+        Options()[name] = value;
+    }
+}
+
+double RunSample(const BenchmarkFn& fn, std::size_t nIterations, long long arg, std::size_t& nItems)
+{
+    State state(nIterations, arg);
+    fn(state);
+    nItems += state.ItemsProcessed();
+    return std::chrono::duration<double>(state.Elapsed()).count();
+}
+
+// Grows the iteration count until one sample takes sampleTime, then runs the remaining samples with that count. The ns
+// per iteration of each sample goes into timings so percentiles can be compared with a baseline.
+Result Run(const std::string& name, const BenchmarkFn& fn, long long arg, double minTime, std::size_t nSamples,
+           Util::FrameTimings& timings)
+{
+    std::size_t nIterations = 1;
+    constexpr std::size_t maxIterations = 1000000000;
+    double sampleTime = minTime / nSamples;
+    std::size_t nItems = 0;
+    double seconds = RunSample(fn, nIterations, arg, nItems);
+
+    while (seconds < sampleTime && nIterations < maxIterations) {
+        // Aim a bit above the sample time, grow at most 10x per round
+        double multiplier = seconds > 0.0 ? 1.4 * sampleTime / seconds : 10.0;
+        multiplier = std::max(2.0, std::min(10.0, multiplier));
+        nIterations = std::min(maxIterations, static_cast<std::size_t>(nIterations * multiplier));
+        nItems = 0;
+        seconds = RunSample(fn, nIterations, arg, nItems);
+    }
+
+    double totalSeconds = seconds;
+    timings.Add(name, seconds * 1e9 / nIterations);
+    for (std::size_t i = 1; i < nSamples; i++) {
+        seconds = RunSample(fn, nIterations, arg, nItems);
+        totalSeconds += seconds;
+        timings.Add(name, seconds * 1e9 / nIterations);
+    }
+
+    Result result{name, nIterations * nSamples, totalSeconds * 1e9 / (nIterations * nSamples), 0.0};
+    if (nItems > 0 && totalSeconds > 0.0) result.itemsPerSecond_ = nItems / totalSeconds;
+    return result;
+}
+
+bool CheckMetrics(const Util::FrameMetrics& metrics)
+{
+    auto metricsPath = GetOption("metrics", "");
+    if (!metricsPath.empty()) {
+        std::ofstream file(metricsPath);
+        if (!file || !Util::WriteFrameMetrics(file, metrics)) {
+            std::cerr << "Could not write " << metricsPath << std::endl;
+            return false;
+        }
+    }
+
+    auto baselinePath = GetOption("baseline", "");
+    if (baselinePath.empty()) return true;
+
+    Util::FrameMetrics baseline;
+    std::ifstream file(baselinePath);
+    if (!file || !Util::ReadFrameMetrics(file, baseline)) {
+        std::cerr << "Could not read baseline " << baselinePath << std::endl;
+        return false;
+    }
+
+    for (const auto& name : Util::MissingInBaseline(baseline, metrics)) {
+        std::cerr << "Warning: " << name << " is not in baseline " << baselinePath << " and is not compared"
+                  << std::endl;
+    }
+    auto tolerance = std::stod(GetOption("tolerance", "0.1"));
+    auto regressions = Util::CompareFrameMetrics(baseline, metrics, tolerance);
+    for (const auto& r : regressions) {
+        std::cerr << "Regression " << r.phase_ << " " << r.metric_ << ": " << std::fixed << std::setprecision(1)
+                  << r.value_ << " ns, baseline " << r.baseline_ << " ns" << std::endl;
+    }
+    if (regressions.empty()) {
+        std::cout << "No regression against " << baselinePath << " with tolerance " << tolerance << std::endl;
+    }
+
+    return regressions.empty();
+}
+
+void WriteJson(const std::string& filePath, const std::vector<Result>& results)
+{
+    std::ofstream os(filePath);
+    os << "{\"benchmarks\": [";
+    std::string separator = "\n";
+    for (const auto& result : results) {
+        os << separator << "{\"name\": \"" << result.name_ << "\", \"iterations\": " << result.nIterations_
+           << ", \"ns_per_iteration\": " << result.nsPerIteration_
+           << ", \"items_per_second\": " << result.itemsPerSecond_ << "}";
+        separator = ",\n";
+    }
+    os << "\n]}\n";
+}
+
+}  // namespace
+
+State::State(std::size_t nIterations, long long arg)
+    : nIterations_(nIterations)
+    , arg_(arg)
+{}
+
+State::Iterator State::begin()
+{
+    ResumeTiming();
+    return {this, nIterations_};
+}
+
+void State::PauseTiming()
+{
+    if (running_) {
+        elapsed_ += std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start_);
+        running_ = false;
+    }
+}
+
+void State::ResumeTiming()
+{
+    if (!running_) {
+        running_ = true;
+        start_ = Clock::now();
+    }
+}
+
+void State::StopTiming()
+{
+    PauseTiming();
+}
+
+bool Register(const std::string& name, BenchmarkFn fn, const std::vector<long long>& args)
+{
+    Entries().push_back({name, fn, args});
+    return true;
+}
+
+std::string GetOption(const std::string& name, const std::string& defaultValue)
+{
+    auto it = Options().find(name);
+    return it != Options().end() ? it->second : defaultValue;
+}
+
+// Options: --filter=<substring> --min_time=<seconds> --samples=<n> --json=<file>
+// --metrics=<file> writes the percentiles of ns per iteration over the samples of each benchmark, p95 and p99 only with
+// enough samples. --baseline=<file> compares them with a metrics file and fails when one is more than --tolerance
+// (default 0.1) above it, which with the default 10 samples is the median. Absolute times only compare on one host,
+// so the baseline is written by the base build on the same machine in the same run, as the CI benchmark job does.
+int RunAll(int argc, char* argv[])
+{
+    ParseOptions(argc, argv);
+    auto filter = GetOption("filter", "");
+    auto minTime = std::stod(GetOption("min_time", "0.5"));
+    auto nSamples = std::max(1, std::stoi(GetOption("samples", "10")));
+    std::vector<Result> results;
+    Util::FrameTimings timings;
+
+    std::cout << std::left << std::setw(48) << "Benchmark" << std::right << std::setw(14) << "ns/iter"
+              << std::setw(14) << "iterations" << std::setw(16) << "items/s" << std::endl;
+    for (const auto& entry : Entries()) {
+        auto args = entry.args_.empty() ? std::vector<long long>{0} : entry.args_;
+        for (auto arg : args) {
+            auto name = entry.args_.empty() ? entry.name_ : entry.name_ + "/" + std::to_string(arg);
+            if (name.find(filter) == std::string::npos) continue;
+            auto result = Run(name, entry.fn_, arg, minTime, nSamples, timings);
+            std::cout << std::left << std::setw(48) << result.name_ << std::right << std::fixed
+                      << std::setprecision(1) << std::setw(14) << result.nsPerIteration_ << std::setw(14)
+                      << result.nIterations_ << std::setw(16) << std::setprecision(0) << result.itemsPerSecond_
+                      << std::endl;
+            results.push_back(result);
+        }
+    }
+
+    auto jsonPath = GetOption("json", "");
+    if (!jsonPath.empty()) WriteJson(jsonPath, results);
+
+    return CheckMetrics(timings.Compute()) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+}  // namespace Benchmark
+
+}  // namespace FA
@@ -0,0 +1,101 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace FA {
+
+namespace Benchmark {
+
+class State
+{
+public:
+    class Iterator
+    {
+    public:
+        Iterator(State* state, std::size_t remaining)
+            : state_(state)
+            , remaining_(remaining)
+        {}
+
+        bool operator!=(const Iterator& other)
+        {
+            if (remaining_ > 0) return true;
+            state_->StopTiming();
+            return false;
+        }
+        Iterator& operator++()
+        {
+            --remaining_;
+            return *this;
+        }
+        int operator*() const { return 0; }
+
+    private:
+        State* state_ = nullptr;
+        std::size_t remaining_{};
+    };
+
+    State(std::size_t nIterations, long long arg);
+
+    Iterator begin();
+    Iterator end() { return {this, 0}; }
+    long long Arg() const { return arg_; }
+    std::size_t Iterations() const { return nIterations_; }
+    void PauseTiming();
+    void ResumeTiming();
+    void SetItemsProcessed(std::size_t nItems) { nItems_ = nItems; }
+    std::size_t ItemsProcessed() const { return nItems_; }
+    std::chrono::nanoseconds Elapsed() const { return elapsed_; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    std::size_t nIterations_{};
+    long long arg_{};
+    std::size_t nItems_{};
+    bool running_ = false;
+    Clock::time_point start_;
+    std::chrono::nanoseconds elapsed_{};
+
+private:
+    void StopTiming();
+};
+
+using BenchmarkFn = std::function<void(State&)>;
+
+bool Register(const std::string& name, BenchmarkFn fn, const std::vector<long long>& args = {});
+std::string GetOption(const std::string& name, const std::string& defaultValue);
+int RunAll(int argc, char* argv[]);
+
+// Keeps the compiler from optimizing away a computed value
+template <class T>
+inline void DoNotOptimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static const volatile void* sink = nullptr;
+    sink = &value;
+#endif
+}
+
+}  // namespace Benchmark
+
+}  // namespace FA
+
+#define BENCHMARK_CONCAT_DETAIL(a, b) a##b
+#define BENCHMARK_CONCAT(a, b) BENCHMARK_CONCAT_DETAIL(a, b)
+
+// BENCHMARK(fn) or BENCHMARK(fn, arg1, arg2, ...) where each arg is passed through State::Arg()
+#define BENCHMARK(fn, ...) \
+    static const bool BENCHMARK_CONCAT(registered, __LINE__) = FA::Benchmark::Register(#fn, fn, {__VA_ARGS__})
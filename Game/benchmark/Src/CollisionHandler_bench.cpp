@@ -0,0 +1,95 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <unordered_set>
+
+#include <SFML/System/Vector2.hpp>
+
+#include "BenchEntity.h"
+#include "Benchmark.h"
+#include "CollisionHandler.h"
+#include "EntityDb.h"
+
+namespace FA {
+
+namespace Entity {
+
+namespace {
+
+constexpr float entitySize = 16.0f;
+constexpr unsigned int nStaticEntities = 50;
+
+// Moving entities spread over an area where roughly one in ten overlaps another one
+class CollisionSetup
+{
+public:
+    CollisionSetup(unsigned int nEntities)
+    {
+        auto side = std::sqrt(static_cast<float>(nEntities)) * entitySize * 3.0f;
+        mapSize_ = {static_cast<unsigned int>(side), static_cast<unsigned int>(side)};
+        std::mt19937 gen(1);
+        std::uniform_real_distribution<float> dist(0.0f, side);
+        EntityId id = 1;
+        for (unsigned int i = 0; i < nEntities; i++, id++) {
+            sf::FloatRect rect(dist(gen), dist(gen), entitySize, entitySize);
+            entityDb_.AddEntity(std::make_unique<BenchEntity>(id, rect, false));
+            entities_.insert(id);
+        }
+        for (unsigned int i = 0; i < nStaticEntities; i++, id++) {
+            sf::FloatRect rect(dist(gen), dist(gen), entitySize * 4, entitySize);
+            entityDb_.AddEntity(std::make_unique<BenchEntity>(id, rect, true));
+            staticEntities_.insert(id);
+        }
+    }
+
+    sf::Vector2u mapSize_;
+    EntityDb entityDb_;
+    std::unordered_set<EntityId> entities_;
+    std::unordered_set<EntityId> staticEntities_;
+};
+
+void CollisionHandler_Detect(Benchmark::State& state)
+{
+    CollisionSetup setup(static_cast<unsigned int>(state.Arg()));
+    CollisionHandler handler(setup.entityDb_);
+    for (auto id : setup.entities_) handler.AddCollider(id);
+    for (auto id : setup.staticEntities_) handler.AddCollider(id);
+
+    for (auto _ : state) {
+        handler.DetectCollisions();
+        handler.DetectOutsideTileMap(setup.mapSize_);
+        handler.HandleCollisions();
+        handler.HandleOutsideTileMap();
+    }
+    state.SetItemsProcessed(state.Iterations() * setup.entities_.size());
+}
+
+void CollisionHandler2_Detect(Benchmark::State& state)
+{
+    CollisionSetup setup(static_cast<unsigned int>(state.Arg()));
+    CollisionHandler2 handler(setup.entityDb_);
+
+    for (auto _ : state) {
+        handler.DetectCollisions(setup.entities_, setup.staticEntities_);
+        handler.DetectOutsideTileMap(setup.mapSize_, setup.entities_);
+        handler.HandleCollisions();
+        handler.HandleOutsideTileMap();
+    }
+    state.SetItemsProcessed(state.Iterations() * setup.entities_.size());
+}
+
+}  // namespace
+
+// Both handlers test every pair, keep the counts moderate
+BENCHMARK(CollisionHandler_Detect, 100, 500, 2000);
+BENCHMARK(CollisionHandler2_Detect, 100, 500, 2000);
+
+}  // namespace Entity
+
+}  // namespace FA
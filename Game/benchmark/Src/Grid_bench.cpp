@@ -0,0 +1,113 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <SFML/System/Vector2.hpp>
+
+#include "BenchEntity.h"
+#include "Benchmark.h"
+#include "CollisionHandler.h"
+#include "EntityDb.h"
+#include "Grid.h"
+
+namespace FA {
+
+namespace Entity {
+
+namespace {
+
+constexpr unsigned int cellSize = 64;
+const sf::Vector2u entitySize{16, 16};
+
+// Same entity density for every entity count, about four entities per cell. The grid works on a real
+// EntityDb and CollisionHandler2 with BenchEntity, so the time is spent in the grid and not in gmock.
+class GridSetup
+{
+public:
+    GridSetup(unsigned int nEntities)
+        : collisionHandler_(entityDb_)
+    {
+        auto side = static_cast<unsigned int>(std::sqrt(static_cast<double>(nEntities)) * cellSize / 2) + cellSize;
+        mapSize_ = {side, side};
+        std::mt19937 gen(1);
+        std::uniform_real_distribution<float> dist(0.0f, static_cast<float>(side - 2 * entitySize.x));
+        for (unsigned int i = 0; i < nEntities; i++) {
+            sf::Vector2f position{dist(gen), dist(gen)};
+            sf::FloatRect rect(position, static_cast<sf::Vector2f>(entitySize));
+            positions_.push_back(position);
+            entityDb_.AddEntity(std::make_unique<BenchEntity>(static_cast<EntityId>(i + 1), rect, false));
+        }
+    }
+
+    void AddAll(Grid& grid) const
+    {
+        for (std::size_t i = 0; i < positions_.size(); i++) {
+            grid.Add(static_cast<EntityId>(i + 1), positions_[i], entitySize);
+        }
+    }
+
+    sf::Vector2u mapSize_;
+    std::vector<sf::Vector2f> positions_;
+    EntityDb entityDb_;
+    CollisionHandler2 collisionHandler_;
+};
+
+void Grid_Add(Benchmark::State& state)
+{
+    GridSetup setup(static_cast<unsigned int>(state.Arg()));
+
+    for (auto _ : state) {
+        Grid grid(setup.mapSize_, cellSize, setup.entityDb_, setup.collisionHandler_);
+        setup.AddAll(grid);
+        Benchmark::DoNotOptimize(grid.Count());
+    }
+    state.SetItemsProcessed(state.Iterations() * setup.positions_.size());
+}
+
+void Grid_Move(Benchmark::State& state)
+{
+    GridSetup setup(static_cast<unsigned int>(state.Arg()));
+    Grid grid(setup.mapSize_, cellSize, setup.entityDb_, setup.collisionHandler_);
+    setup.AddAll(grid);
+    float offset = 0.0f;
+
+    for (auto _ : state) {
+        // Move back and forth across a cell border
+        offset = offset > 0.0f ? 0.0f : cellSize / 2.0f;
+        for (std::size_t i = 0; i < setup.positions_.size(); i++) {
+            auto position = setup.positions_[i] + sf::Vector2f(offset, 0.0f);
+            grid.Move(static_cast<EntityId>(i + 1), position, entitySize);
+        }
+    }
+    state.SetItemsProcessed(state.Iterations() * setup.positions_.size());
+}
+
+void Grid_DetectCollisions(Benchmark::State& state)
+{
+    GridSetup setup(static_cast<unsigned int>(state.Arg()));
+    Grid grid(setup.mapSize_, cellSize, setup.entityDb_, setup.collisionHandler_);
+    setup.AddAll(grid);
+
+    for (auto _ : state) {
+        grid.DetectCollisions();
+        grid.HandleCollisions();
+    }
+    state.SetItemsProcessed(state.Iterations() * setup.positions_.size());
+}
+
+}  // namespace
+
+BENCHMARK(Grid_Add, 100, 1000, 10000, 100000);
+BENCHMARK(Grid_Move, 100, 1000, 10000, 100000);
+BENCHMARK(Grid_DetectCollisions, 100, 1000, 10000, 100000);
+
+}  // namespace Entity
+
+}  // namespace FA
@@ -0,0 +1,20 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <gmock/gmock.h>
+
+#include "Benchmark.h"
+#include "Mock/LoggerMock.h"
+#include "Mock/TmxLoggerMock.h"
+
+int main(int argc, char* argv[])
+{
+    // Logging is substituted at link time by the mocks, keep them quiet
+    testing::NiceMock<FA::Shared::LoggerMock> loggerMock;
+    testing::NiceMock<FA::Tile::LoggerMock> tmxLoggerMock;
+
+    return FA::Benchmark::RunAll(argc, argv);
+}
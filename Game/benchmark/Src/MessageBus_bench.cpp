@@ -0,0 +1,43 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <memory>
+#include <string>
+
+#include "Benchmark.h"
+#include "Message/BroadcastMessage/KeyPressedMessage.h"
+#include "Message/MessageBus.h"
+#include "Message/MessageType.h"
+
+namespace FA {
+
+namespace Shared {
+
+namespace {
+
+void MessageBus_SendMessage(Benchmark::State& state)
+{
+    MessageBus messageBus;
+    unsigned int nReceived = 0;
+    for (long long i = 0; i < state.Arg(); i++) {
+        messageBus.AddSubscriber("subscriber" + std::to_string(i), MessageType::KeyPressed,
+                                 [&nReceived](std::shared_ptr<Message> msg) { nReceived++; });
+    }
+
+    for (auto _ : state) {
+        messageBus.SendMessage(std::make_shared<KeyPressedMessage>(sf::Keyboard::Key::Right));
+    }
+    Benchmark::DoNotOptimize(nReceived);
+    state.SetItemsProcessed(state.Iterations() * static_cast<std::size_t>(state.Arg()));
+}
+
+}  // namespace
+
+BENCHMARK(MessageBus_SendMessage, 1, 10, 100, 1000);
+
+}  // namespace Shared
+
+}  // namespace FA
@@ -0,0 +1,119 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <memory>
+#include <vector>
+
+#include <SFML/Graphics/Rect.hpp>
+
+#include "Benchmark.h"
+#include "RectangleShape.h"
+#include "RenderBackend.h"
+#include "RenderCommandBuffer.h"
+#include "RenderTexture.h"
+#include "Sprite.h"
+#include "Text.h"
+#include "Texture.h"
+
+namespace FA {
+
+namespace Graphic {
+
+namespace {
+
+constexpr unsigned int nTextures = 4;
+constexpr unsigned int spritesPerRun = 64;  // sprites in a row with the same texture, like a sorted entity layer
+constexpr unsigned int tileSize = 16;
+constexpr unsigned int tilesPerRow = 64;
+
+// Graphic objects read the backend when constructed, so this is set up before them
+class NullBackend
+{
+public:
+    NullBackend() { SetRenderBackend(RenderBackend::Null); }
+    ~NullBackend() { SetRenderBackend(RenderBackend::Sfml); }
+};
+
+// A level frame of sprites, with a shape and a text drawn on top, drawn with the null backend so the time is
+// spent in the command buffer and not in the driver
+class FrameSetup
+{
+public:
+    FrameSetup(unsigned int nSprites)
+    {
+        target_.create(1, 1);
+        for (unsigned int i = 0; i < nTextures; i++) {
+            textures_.push_back(std::make_unique<Texture>());
+            textures_.back()->create(256, 256);
+        }
+        sprites_.resize(nSprites);
+        for (unsigned int i = 0; i < nSprites; i++) {
+            auto& sprite = sprites_[i];
+            sprite.setTexture(*textures_[(i / spritesPerRun) % nTextures]);
+            sprite.setTextureRect({0, 0, tileSize, tileSize});
+            sprite.setPosition(static_cast<float>((i % tilesPerRow) * tileSize),
+                               static_cast<float>((i / tilesPerRow) * tileSize));
+        }
+        shape_.setSize({100.0f, 20.0f});
+        text_.setString("fps 120");
+    }
+
+    void Record(RenderCommandBuffer& commands) const
+    {
+        commands.Clear();
+        for (const auto& sprite : sprites_) {
+            commands.draw(sprite);
+        }
+        commands.draw(shape_);
+        commands.draw(text_);
+    }
+
+    std::size_t GetDrawableCount() const { return sprites_.size() + 2; }
+    RenderTargetIf& GetTarget() { return target_; }
+
+private:
+    NullBackend nullBackend_;
+    RenderTexture target_;
+    std::vector<std::unique_ptr<Texture>> textures_;
+    std::vector<Sprite> sprites_;
+    RectangleShape shape_;
+    Text text_;
+};
+
+void RenderCommandBuffer_Record(Benchmark::State& state)
+{
+    FrameSetup setup(static_cast<unsigned int>(state.Arg()));
+    RenderCommandBuffer commands;
+    setup.Record(commands);
+
+    for (auto _ : state) {
+        setup.Record(commands);
+        Benchmark::DoNotOptimize(commands.GetCount());
+    }
+    state.SetItemsProcessed(state.Iterations() * setup.GetDrawableCount());
+}
+
+// Executes the same recorded frame again, as a pipelined frame is executed while the next one is recorded
+void RenderCommandBuffer_Replay(Benchmark::State& state)
+{
+    FrameSetup setup(static_cast<unsigned int>(state.Arg()));
+    RenderCommandBuffer commands;
+    setup.Record(commands);
+
+    for (auto _ : state) {
+        commands.Execute(setup.GetTarget());
+    }
+    state.SetItemsProcessed(state.Iterations() * setup.GetDrawableCount());
+}
+
+}  // namespace
+
+BENCHMARK(RenderCommandBuffer_Record, 100, 1000, 10000);
+BENCHMARK(RenderCommandBuffer_Replay, 100, 1000, 10000);
+
+}  // namespace Graphic
+
+}  // namespace FA
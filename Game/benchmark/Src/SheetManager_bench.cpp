@@ -0,0 +1,52 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Benchmark.h"
+#include "Resource/SheetItem.h"
+#include "Resource/SheetManager.h"
+#include "Resource/SpriteSheet.h"
+#include "Resource/TextureRect.h"
+
+namespace FA {
+
+namespace Shared {
+
+namespace {
+
+// Same number of sheets as textureSheets in world/Src/Sheets.h
+constexpr unsigned int nSheets = 20;
+const sf::Vector2u rectCount{4, 4};
+
+void SheetManager_GetTextureRect(Benchmark::State& state)
+{
+    SheetManager sheetManager;
+    std::vector<SheetItem> items;
+    for (unsigned int i = 0; i < nSheets; i++) {
+        auto name = "sheet" + std::to_string(i);
+        sheetManager.AddSheet(name, std::make_unique<SpriteSheet>(i, sf::Vector2u(256, 256), rectCount));
+        items.push_back({name, {i % rectCount.x, i % rectCount.y}});
+    }
+    std::size_t index = 0;
+
+    for (auto _ : state) {
+        auto rect = sheetManager.GetTextureRect(items[index]);
+        Benchmark::DoNotOptimize(rect);
+        index = (index + 1) % items.size();
+    }
+    state.SetItemsProcessed(state.Iterations());
+}
+
+}  // namespace
+
+BENCHMARK(SheetManager_GetTextureRect);
+
+}  // namespace Shared
+
+}  // namespace FA
@@ -0,0 +1,77 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <memory>
+
+#include <tinyxml2/tinyxml2.h>
+
+#include "Benchmark.h"
+#include "ByteStreamFactory.h"
+#include "ParseHelper.h"
+#include "TileMapData.h"
+#include "TileMapParser.h"
+#include "TileService.h"
+#include "TileSetFactory.h"
+#include "TmxParser.h"
+#include "TsxParser.h"
+
+namespace FA {
+
+namespace Tile {
+
+namespace {
+
+using ParseHelperImpl = ParseHelper<tinyxml2::XMLElement, tinyxml2::XMLError>;
+using TileServiceImpl = TileService<tinyxml2::XMLDocument, tinyxml2::XMLElement, tinyxml2::XMLError>;
+using TmxParserImpl = TmxParser<tinyxml2::XMLDocument, tinyxml2::XMLElement, tinyxml2::XMLError>;
+using TsxParserImpl = TsxParser<tinyxml2::XMLDocument, tinyxml2::XMLElement, tinyxml2::XMLError>;
+
+// Assets folder can be set with --assets=<path>, default works when run from the benchmark folder
+std::string MapPath()
+{
+    return Benchmark::GetOption("assets", "../App/assets") + "/map/levelCollider.tmx";
+}
+
+std::unique_ptr<TileServiceImpl> CreateTileService()
+{
+    auto helper = std::make_shared<ParseHelperImpl>();
+    return std::make_unique<TileServiceImpl>(std::make_unique<TmxParserImpl>(helper),
+                                             std::make_unique<TsxParserImpl>(helper),
+                                             std::make_unique<TileSetFactory>(),
+                                             std::make_unique<Util::ByteStreamFactory>());
+}
+
+void TileService_ReadLayers(Benchmark::State& state)
+{
+    auto tileService = CreateTileService();
+    tileService->Parse(MapPath());
+
+    for (auto _ : state) {
+        auto layers = tileService->ReadLayers();
+        Benchmark::DoNotOptimize(layers);
+    }
+    state.SetItemsProcessed(state.Iterations());
+}
+
+void TileMapParser_Run(Benchmark::State& state)
+{
+    TileMapParser parser;
+
+    for (auto _ : state) {
+        auto tileMapData = parser.Run(MapPath());
+        Benchmark::DoNotOptimize(tileMapData);
+    }
+    state.SetItemsProcessed(state.Iterations());
+}
+
+}  // namespace
+
+BENCHMARK(TileService_ReadLayers);
+BENCHMARK(TileMapParser_Run);
+
+}  // namespace Tile
+
+}  // namespace FA
@@ -0,0 +1,49 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+namespace FA {
+
+namespace Entity {
+
+// Side effects on state shared between entities (creation and deletion pools, message bus), recorded while entities
+// are updated on worker threads. Commands are applied in the order they were added.
+class CommandBuffer
+{
+public:
+    using Command = std::function<void()>;
+
+    // Makes buffer the active one of the calling thread while in scope
+    class Scope
+    {
+    public:
+        explicit Scope(CommandBuffer& buffer);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        CommandBuffer* prev_ = nullptr;
+    };
+
+    static CommandBuffer* GetActive();  // nullptr when side effects shall be done directly
+
+    void Add(Command command) { commands_.push_back(std::move(command)); }
+    void Apply();  // runs and clears the commands
+    std::size_t GetCount() const { return commands_.size(); }
+
+private:
+    std::vector<Command> commands_;
+};
+
+}  // namespace Entity
+
+}  // namespace FA
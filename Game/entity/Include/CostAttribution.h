@@ -0,0 +1,106 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <iosfwd>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "EntityType.h"
+#include "Id.h"
+
+namespace FA {
+
+namespace Entity {
+
+class EntityIf;
+
+// Time and call count per entity type for the update, collision and draw phases. Add may be called from worker
+// threads and accumulates per thread without a lock. The rest is only called from the game loop thread while no Add
+// runs, EndFrame merges the threads. Collision includes both intersection tests and collision handling.
+class CostAttribution
+{
+public:
+    enum class Phase { Update, Collision, Draw };
+    static constexpr std::size_t nPhases = 3;
+
+    struct Cost
+    {
+        double ms_{};
+        unsigned int nCalls_{};
+    };
+
+    struct EntityCost
+    {
+        EntityId id_{};
+        EntityType type_{};
+        double ms_{};  // all phases
+    };
+
+    using Costs = std::array<Cost, nPhases>;
+    using TypeCosts = std::map<EntityType, Costs>;
+    using Clock = std::chrono::steady_clock;
+
+    static CostAttribution& Instance();
+
+    void Enable(bool enable, unsigned int nTopEntities = 0);
+    bool IsEnabled() const { return enabled_; }
+    void Add(Phase phase, EntityType type, EntityId id, double ms);
+    void EndFrame();
+    void Clear();
+
+    const TypeCosts& GetFrameCosts() const { return frameCosts_; }  // last completed frame
+    const TypeCosts& GetTotalCosts() const { return totalCosts_; }
+    unsigned int GetFrameCount() const { return nFrames_; }
+    const std::vector<EntityCost>& GetTopEntities() const { return topEntities_; }  // last completed frame
+    void WriteCsv(std::ostream& os) const;
+
+private:
+    struct ThreadCosts
+    {
+        TypeCosts costs_;
+        std::unordered_map<EntityId, EntityCost> entityCosts_;
+    };
+
+    bool enabled_ = false;
+    std::mutex mutex_;  // guards threadCosts_
+    std::vector<std::unique_ptr<ThreadCosts>> threadCosts_;
+    unsigned int nTopEntities_{};
+    TypeCosts frameCosts_;
+    TypeCosts totalCosts_;
+    unsigned int nFrames_{};
+    std::unordered_map<EntityId, EntityCost> frameEntityCosts_;
+    std::vector<EntityCost> topEntities_;
+
+private:
+    CostAttribution() = default;
+    ThreadCosts& GetThreadCosts();
+};
+
+class ScopedCost
+{
+public:
+    ScopedCost(CostAttribution::Phase phase, const EntityIf& entity);
+    ~ScopedCost();
+
+    ScopedCost(const ScopedCost&) = delete;
+    ScopedCost& operator=(const ScopedCost&) = delete;
+
+private:
+    CostAttribution::Phase phase_;
+    const EntityIf* entity_ = nullptr;
+    CostAttribution::Clock::time_point start_;
+};
+
+}  // namespace Entity
+
+}  // namespace FA
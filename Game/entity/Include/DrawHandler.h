@@ -6,7 +6,13 @@
 
 #pragma once
 
+#include <cstddef>
 #include <map>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <SFML/Graphics/Rect.hpp>
 
 #include "Id.h"
 #include "LayerType.h"
@@ -22,27 +28,72 @@ class RenderTargetIf;
 namespace Entity {
 
 class EntityDb;
+class EntityIf;
 
+// Drawables are kept in one bucket per layer, buckets are drawn in layer order. A bucket keeps its drawables in the
+// order they were added, removing one only marks it removed and the bucket is compacted when half of it is removed.
+// Static entities are indexed on the cell of their top left corner when added, so DrawTo only visits the cells near the
+// visible area. Each cell and the moving list hold positions in the bucket in add order, so the visible ones are merged
+// back into add order instead of sorted. Moving entities have their draw bounds read every frame.
 class DrawHandler
 {
 public:
-    DrawHandler(const EntityDb &entityDb);
+    DrawHandler(const EntityDb &entityDb, float cellSize);
     ~DrawHandler();
 
     void AddDrawable(EntityId id);
     void RemoveDrawable(EntityId id);
-    void DrawTo(Graphic::RenderTargetIf &renderTarget) const;
+    // Drawables in layer are sorted on the bottom of their draw bounds, lower ones are drawn in front. The order of
+    // the last frame is sorted again, which is cheap as few drawables pass each other in one frame. Otherwise they are
+    // drawn in the order they were added.
+    void EnableYSort(LayerType layer);
+    // Only entities whose draw bounds intersect visibleArea are drawn. Static entities must not move.
+    void DrawTo(Graphic::RenderTargetIf &renderTarget, const sf::FloatRect &visibleArea);
 
 private:
+    using CellKey = std::pair<int, int>;  // row and column
+
     struct DrawableInfo
     {
-        LayerType layer_{};
         EntityId id_{};
+        const EntityIf *entity_ = nullptr;  // owned by EntityDb, null when removed so it is never read after delete
+        sf::FloatRect bounds_;
+        unsigned int visibleFrame_{};  // last frame it was visible in
+        unsigned int sortedFrame_{};   // last frame it kept its place in the y sorted list
+    };
+
+    struct Bucket
+    {
+        std::vector<DrawableInfo> drawables_;  // in add order, so a position is also the draw order
+        std::size_t nRemoved_{};
+        std::vector<std::size_t> moving_;                    // positions in drawables_
+        std::map<CellKey, std::vector<std::size_t>> cells_;  // positions in drawables_ of static drawables
+        float maxOverhang_{};                                // static drawables can reach out of their cell
+        bool ySort_ = false;
+        std::vector<std::size_t> ySorted_;  // visible drawables of the last frame, sorted on bottom
+    };
+
+    struct Handle
+    {
+        LayerType layer_{};
+        std::size_t index_{};
     };
 
-private:
     const EntityDb &entityDb_;
-    std::map<std::string, DrawableInfo> drawables_;
+    float cellSize_{};
+    std::map<LayerType, Bucket> buckets_;
+    std::unordered_map<EntityId, Handle> handles_;
+    unsigned int frame_{};
+    // reused every frame
+    std::vector<std::size_t> visible_;
+    std::vector<std::size_t> runStarts_;
+    std::vector<std::size_t> merged_;
+
+private:
+    void CollectVisible(Bucket &bucket, const sf::FloatRect &visibleArea);
+    void MergeRuns();
+    void SortOnBottom(Bucket &bucket);
+    void Compact(Bucket &bucket);
 };
 
 }  // namespace Entity
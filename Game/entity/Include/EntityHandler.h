@@ -6,8 +6,12 @@
 
 #pragma once
 
+#include <cstddef>
+#include <memory>
 #include <unordered_set>
+#include <vector>
 
+#include "CommandBuffer.h"
 #include "Id.h"
 #include "Resource/TextureManager.h"
 
@@ -25,10 +29,17 @@ class CameraViews;
 namespace Entity {
 
 class EntityDb;
+class EntityIf;
 class Factory;
 class EntityLifeHandler;
 class ObjIdTranslator;
 
+// Entities per job when entities are updated in parallel, 0 updates them serially in the calling thread. In parallel
+// mode an entity must only read other entities in Update. In both modes creations, deletions and messages from Update
+// are deferred until all entities are updated, and then applied in the serial update order.
+void SetEntityUpdateChunkSize(std::size_t chunkSize);
+std::size_t GetEntityUpdateChunkSize();
+
 class EntityHandler
 {
 public:
@@ -36,15 +47,22 @@ public:
     ~EntityHandler();
 
     void Update(float deltaTime);
+    void Interpolate(float alpha);
     EntityId AddEntity(const Shared::EntityData &data, const Factory &factory, Shared::MessageBus &messageBus,
                        const Shared::TextureManager &textureManager, const Shared::SheetManager &sheetManager,
                        const Shared::CameraViews &cameraViews, EntityLifeHandler &entityLifeHandler,
                        const ObjIdTranslator &objIdTranslator);
+    EntityId AddEntity(std::unique_ptr<EntityIf> entity);
     void RemoveEntity(EntityId id);
 
 private:
     EntityDb &entityDb_;
     std::unordered_set<Entity::EntityId> allEntities_;
+    std::vector<EntityId> updateOrder_;
+    std::vector<CommandBuffer> commandBuffers_;
+
+private:
+    void UpdateEntity(EntityId id, float deltaTime);
 };
 
 }  // namespace Entity
@@ -34,7 +34,9 @@ public:
     virtual void Destroy() = 0;
     virtual void Init() = 0;
     virtual void Update(float deltaTime) = 0;
+    virtual void Interpolate(float alpha) = 0;
     virtual void DrawTo(Graphic::RenderTargetIf& renderTarget) const = 0;
+    virtual sf::FloatRect GetDrawBounds() const = 0;
     virtual bool Intersect(const EntityIf& otherEntity) const = 0;
     virtual bool IsOutsideTileMap(const sf::FloatRect& rect) const = 0;
     virtual void HandleCollision(const EntityId id) = 0;
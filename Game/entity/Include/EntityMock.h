@@ -8,6 +8,8 @@
 
 #include <gmock/gmock.h>
 
+#include <SFML/Graphics/Rect.hpp>
+
 #include "EntityIf.h"
 #include "RenderTargetIf.h"
 
@@ -25,7 +27,9 @@ public:
     MOCK_METHOD((void), Destroy, (), (override));
     MOCK_METHOD((void), Init, (), (override));
     MOCK_METHOD((void), Update, (float), (override));
+    MOCK_METHOD((void), Interpolate, (float), (override));
     MOCK_METHOD((void), DrawTo, (Graphic::RenderTargetIf&), (const override));
+    MOCK_METHOD((sf::FloatRect), GetDrawBounds, (), (const override));
     MOCK_METHOD((bool), Intersect, (const EntityIf&), (const override));
     MOCK_METHOD((bool), IsOutsideTileMap, (const sf::FloatRect&), (const override));
     MOCK_METHOD((void), HandleCollision, (const EntityId), (override));
@@ -48,7 +52,9 @@ public:
     virtual void Destroy() override { mock_.Destroy(); }
     virtual void Init() override { mock_.Init(); }
     virtual void Update(float deltaTime) override { mock_.Update(deltaTime); }
+    virtual void Interpolate(float alpha) override { mock_.Interpolate(alpha); }
     virtual void DrawTo(Graphic::RenderTargetIf& renderTarget) const override { mock_.DrawTo(renderTarget); }
+    virtual sf::FloatRect GetDrawBounds() const override { return mock_.GetDrawBounds(); }
     virtual bool Intersect(const EntityIf& otherEntity) const override { return mock_.Intersect(otherEntity); }
     virtual bool IsOutsideTileMap(const sf::FloatRect& rect) const override { return mock_.IsOutsideTileMap(rect); }
     virtual void HandleCollision(const EntityId id) override { mock_.HandleCollision(id); }
@@ -64,6 +64,7 @@ void DoorMoveAbility::Update(float deltaTime)
         movementVector_ = CalculateMovementVector(MoveDirection::Down);
         body_.position_ = exitPosition_;
         body_.position_.y -= moveDistance_;
+        body_.prevPosition_ = body_.position_;  // jump, don't interpolate
         state_ = State::MovingFromExit;
     }
     else if (state_ == State::MovingFromExit) {
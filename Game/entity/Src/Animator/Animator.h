@@ -85,7 +85,7 @@ private:
             animation_ = map_.at(key_);
         }
         else {
-            LOG_ERROR("%s can not be found", DUMP(key_));
+            LOG_ERROR_CH(FA::Shared::LogChannel::Entity, "%s can not be found", DUMP(key_));
         }
     }
 };
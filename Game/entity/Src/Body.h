@@ -15,7 +15,8 @@ namespace Entity {
 struct Body
 {
     sf::Vector2f position_;
-    sf::Vector2f prevPosition_;
+    sf::Vector2f prevPosition_;    // position at start of current tick
+    sf::Vector2f renderPosition_;  // interpolated between prevPosition_ and position_
     float rotation_{};
     float scale_{};
 };
@@ -9,6 +9,7 @@
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/System/Vector2.hpp>
 
+#include "CostAttribution.h"
 #include "EntityDb.h"
 #include "EntityIf.h"
 
@@ -50,7 +51,9 @@ void CollisionHandler::RemoveCollider(EntityId id)
 
 void CollisionHandler::DetectCollisions()
 {
+    // Timed once per entity, a scope per intersect test would cost more than the test itself
     for (const auto id : entities_) {
+        ScopedCost cost(CostAttribution::Phase::Collision, entityDb_.GetEntity(id));
         DetectEntityCollisions(id);
         DetectStaticCollisions(id);
     }
@@ -62,6 +65,7 @@ void CollisionHandler::DetectOutsideTileMap(const sf::Vector2u &mapSize)
 
     for (const auto id : entities_) {
         const auto &entity = entityDb_.GetEntity(id);
+        ScopedCost cost(CostAttribution::Phase::Collision, entity);
         bool isOutside = entity.IsOutsideTileMap(rect);
         if (isOutside) {
             entitiesOutsideTileMap_.insert(id);
@@ -104,8 +108,14 @@ void CollisionHandler::HandleCollisions()
     for (const auto &pair : collisionPairs_) {
         auto &first = entityDb_.GetEntity(pair.first);
         auto &second = entityDb_.GetEntity(pair.second);
-        first.HandleCollision(pair.second);
-        second.HandleCollision(pair.first);
+        {
+            ScopedCost cost(CostAttribution::Phase::Collision, first);
+            first.HandleCollision(pair.second);
+        }
+        {
+            ScopedCost cost(CostAttribution::Phase::Collision, second);
+            second.HandleCollision(pair.first);
+        }
     }
     collisionPairs_.clear();
 }
@@ -114,6 +124,7 @@ void CollisionHandler::HandleOutsideTileMap()
 {
     for (const auto id : entitiesOutsideTileMap_) {
         auto &entity = entityDb_.GetEntity(id);
+        ScopedCost cost(CostAttribution::Phase::Collision, entity);
         entity.HandleOutsideTileMap();
     }
     entitiesOutsideTileMap_.clear();
@@ -129,6 +140,7 @@ void CollisionHandler2::DetectCollisions(const std::unordered_set<EntityId> &ent
                                          const std::unordered_set<EntityId> &staticEntities)
 {
     for (const auto id : entities) {
+        ScopedCost cost(CostAttribution::Phase::Collision, entityDb_.GetEntity(id));
         DetectEntityCollisions(id, entities);
         DetectStaticCollisions(id, staticEntities);
     }
@@ -140,6 +152,7 @@ void CollisionHandler2::DetectOutsideTileMap(const sf::Vector2u &mapSize, const
 
     for (const auto id : entities) {
         const auto &entity = entityDb_.GetEntity(id);
+        ScopedCost cost(CostAttribution::Phase::Collision, entity);
         bool isOutside = entity.IsOutsideTileMap(rect);
         if (isOutside) {
             entitiesOutsideTileMap_.insert(id);
@@ -182,8 +195,14 @@ void CollisionHandler2::HandleCollisions()
     for (const auto &pair : collisionPairs_) {
         auto &first = entityDb_.GetEntity(pair.first);
         auto &second = entityDb_.GetEntity(pair.second);
-        first.HandleCollision(pair.second);
-        second.HandleCollision(pair.first);
+        {
+            ScopedCost cost(CostAttribution::Phase::Collision, first);
+            first.HandleCollision(pair.second);
+        }
+        {
+            ScopedCost cost(CostAttribution::Phase::Collision, second);
+            second.HandleCollision(pair.first);
+        }
     }
     collisionPairs_.clear();
 }
@@ -192,6 +211,7 @@ void CollisionHandler2::HandleOutsideTileMap()
 {
     for (const auto id : entitiesOutsideTileMap_) {
         auto &entity = entityDb_.GetEntity(id);
+        ScopedCost cost(CostAttribution::Phase::Collision, entity);
         entity.HandleOutsideTileMap();
     }
     entitiesOutsideTileMap_.clear();
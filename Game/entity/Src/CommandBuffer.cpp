@@ -0,0 +1,45 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "CommandBuffer.h"
+
+namespace FA {
+
+namespace Entity {
+
+namespace {
+
+thread_local CommandBuffer* activeBuffer = nullptr;
+
+}  // namespace
+
+CommandBuffer::Scope::Scope(CommandBuffer& buffer)
+    : prev_(activeBuffer)
+{
+    activeBuffer = &buffer;
+}
+
+CommandBuffer::Scope::~Scope()
+{
+    activeBuffer = prev_;
+}
+
+CommandBuffer* CommandBuffer::GetActive()
+{
+    return activeBuffer;
+}
+
+void CommandBuffer::Apply()
+{
+    for (auto& command : commands_) {
+        command();
+    }
+    commands_.clear();
+}
+
+}  // namespace Entity
+
+}  // namespace FA
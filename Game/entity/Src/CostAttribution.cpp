@@ -0,0 +1,158 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "CostAttribution.h"
+
+#include <algorithm>
+#include <ostream>
+
+#include "EntityIf.h"
+
+namespace FA {
+
+namespace Entity {
+
+namespace {
+
+const char* phaseNames[CostAttribution::nPhases] = {"Update", "Collision", "Draw"};
+
+void AddCosts(CostAttribution::Costs& to, const CostAttribution::Costs& from)
+{
+    for (std::size_t i = 0; i < CostAttribution::nPhases; i++) {
+        to[i].ms_ += from[i].ms_;
+        to[i].nCalls_ += from[i].nCalls_;
+    }
+}
+
+}  // namespace
+
+CostAttribution& CostAttribution::Instance()
+{
+    static CostAttribution costAttribution;
+    return costAttribution;
+}
+
+void CostAttribution::Enable(bool enable, unsigned int nTopEntities)
+{
+    enabled_ = enable;
+    nTopEntities_ = nTopEntities;
+}
+
+void CostAttribution::Add(Phase phase, EntityType type, EntityId id, double ms)
+{
+    auto& threadCosts = GetThreadCosts();
+    auto& cost = threadCosts.costs_[type][static_cast<std::size_t>(phase)];
+    cost.ms_ += ms;
+    cost.nCalls_++;
+
+    if (nTopEntities_ > 0) {
+        auto& entityCost = threadCosts.entityCosts_[id];
+        entityCost.id_ = id;
+        entityCost.type_ = type;
+        entityCost.ms_ += ms;
+    }
+}
+
+void CostAttribution::EndFrame()
+{
+    frameCosts_.clear();
+    frameEntityCosts_.clear();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& threadCosts : threadCosts_) {
+            for (const auto& entry : threadCosts->costs_) {
+                AddCosts(frameCosts_[entry.first], entry.second);
+            }
+            // The same entity can be reported from several threads, e.g. update on a worker and draw on the game loop
+            for (const auto& entry : threadCosts->entityCosts_) {
+                auto& entityCost = frameEntityCosts_[entry.first];
+                entityCost.id_ = entry.second.id_;
+                entityCost.type_ = entry.second.type_;
+                entityCost.ms_ += entry.second.ms_;
+            }
+            threadCosts->costs_.clear();
+            threadCosts->entityCosts_.clear();
+        }
+    }
+    for (const auto& entry : frameCosts_) {
+        AddCosts(totalCosts_[entry.first], entry.second);
+    }
+
+    topEntities_.clear();
+    for (const auto& entry : frameEntityCosts_) {
+        topEntities_.push_back(entry.second);
+    }
+    auto n = std::min<std::size_t>(nTopEntities_, topEntities_.size());
+    std::partial_sort(topEntities_.begin(), topEntities_.begin() + n, topEntities_.end(),
+                      [](const EntityCost& lhs, const EntityCost& rhs) { return lhs.ms_ > rhs.ms_; });
+    topEntities_.resize(n);
+
+    nFrames_++;
+}
+
+void CostAttribution::Clear()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& threadCosts : threadCosts_) {
+            threadCosts->costs_.clear();
+            threadCosts->entityCosts_.clear();
+        }
+    }
+    frameCosts_.clear();
+    totalCosts_.clear();
+    frameEntityCosts_.clear();
+    topEntities_.clear();
+    nFrames_ = 0;
+}
+
+void CostAttribution::WriteCsv(std::ostream& os) const
+{
+    os << "type,phase,calls,total_ms,ms_per_frame\n";
+    for (const auto& entry : totalCosts_) {
+        for (std::size_t i = 0; i < nPhases; i++) {
+            const auto& cost = entry.second[i];
+            if (cost.nCalls_ == 0) continue;
+            auto msPerFrame = nFrames_ > 0 ? cost.ms_ / nFrames_ : 0.0;
+            os << entry.first << "," << phaseNames[i] << "," << cost.nCalls_ << "," << cost.ms_ << "," << msPerFrame
+               << "\n";
+        }
+    }
+}
+
+CostAttribution::ThreadCosts& CostAttribution::GetThreadCosts()
+{
+    // Only the first Add of a thread takes the lock. There is a single instance, so one pointer per thread is enough.
+    thread_local ThreadCosts* threadCosts = nullptr;
+    if (threadCosts == nullptr) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        threadCosts_.push_back(std::make_unique<ThreadCosts>());
+        threadCosts = threadCosts_.back().get();
+    }
+
+    return *threadCosts;
+}
+
+ScopedCost::ScopedCost(CostAttribution::Phase phase, const EntityIf& entity)
+    : phase_(phase)
+{
+    if (CostAttribution::Instance().IsEnabled()) {
+        entity_ = &entity;
+        start_ = CostAttribution::Clock::now();
+    }
+}
+
+ScopedCost::~ScopedCost()
+{
+    if (entity_ == nullptr) return;
+
+    std::chrono::duration<double, std::milli> elapsed = CostAttribution::Clock::now() - start_;
+    CostAttribution::Instance().Add(phase_, entity_->Type(), entity_->GetId(), elapsed.count());
+}
+
+}  // namespace Entity
+
+}  // namespace FA
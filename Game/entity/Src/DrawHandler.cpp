@@ -6,8 +6,11 @@
 
 #include "DrawHandler.h"
 
-#include <sstream>
+#include <algorithm>
+#include <cmath>
+#include <iterator>
 
+#include "CostAttribution.h"
 #include "EntityDb.h"
 #include "EntityIf.h"
 
@@ -15,36 +18,210 @@ namespace FA {
 
 namespace Entity {
 
-DrawHandler::DrawHandler(const EntityDb &entityDb)
+namespace {
+
+constexpr auto removedIndex = static_cast<std::size_t>(-1);
+
+float Bottom(const sf::FloatRect &rect)
+{
+    return rect.top + rect.height;
+}
+
+}  // namespace
+
+DrawHandler::DrawHandler(const EntityDb &entityDb, float cellSize)
     : entityDb_(entityDb)
+    , cellSize_(cellSize)
 {}
 
 DrawHandler::~DrawHandler() = default;
 
 void DrawHandler::AddDrawable(EntityId id)
 {
+    if (handles_.find(id) != handles_.end()) return;
+
     const auto &entity = entityDb_.GetEntity(id);
-    auto layer = entity.GetLayer();
+    Handle handle{entity.GetLayer(), 0};
+    auto &bucket = buckets_[handle.layer_];
+    handle.index_ = bucket.drawables_.size();
+    if (entity.IsStatic()) {
+        auto bounds = entity.GetDrawBounds();
+        int row = static_cast<int>(std::floor(bounds.top / cellSize_));
+        int column = static_cast<int>(std::floor(bounds.left / cellSize_));
+        bucket.cells_[{row, column}].push_back(handle.index_);
+        bucket.drawables_.push_back({id, &entity, bounds});
 
-    std::stringstream ss;
-    int l = static_cast<int>(layer);
-    ss << l << "_" << id;
-    drawables_[ss.str()] = {layer, id};
+        float overhangX = bounds.left + bounds.width - (column + 1) * cellSize_;
+        float overhangY = bounds.top + bounds.height - (row + 1) * cellSize_;
+        bucket.maxOverhang_ = std::max({bucket.maxOverhang_, overhangX, overhangY});
+    }
+    else {
+        bucket.moving_.push_back(handle.index_);
+        bucket.drawables_.push_back({id, &entity, {}});
+    }
+    handles_[id] = handle;
 }
 
 void DrawHandler::RemoveDrawable(EntityId id)
 {
-    auto it = std::find_if(drawables_.begin(), drawables_.end(), [id](const auto &p) { return p.second.id_ == id; });
-    if (it != drawables_.end()) {
-        drawables_.erase(it);
+    auto it = handles_.find(id);
+    if (it == handles_.end()) return;
+
+    auto handle = it->second;
+    handles_.erase(it);
+    auto &bucket = buckets_[handle.layer_];
+    bucket.drawables_[handle.index_].entity_ = nullptr;
+    bucket.nRemoved_++;
+    if (2 * bucket.nRemoved_ >= bucket.drawables_.size()) {
+        Compact(bucket);
+    }
+}
+
+void DrawHandler::EnableYSort(LayerType layer)
+{
+    buckets_[layer].ySort_ = true;
+}
+
+void DrawHandler::DrawTo(Graphic::RenderTargetIf &renderTarget, const sf::FloatRect &visibleArea)
+{
+    frame_++;
+    for (auto &entry : buckets_) {
+        auto &bucket = entry.second;
+        CollectVisible(bucket, visibleArea);
+        if (bucket.ySort_) {
+            SortOnBottom(bucket);
+        }
+        else {
+            MergeRuns();
+        }
+
+        for (auto index : bucket.ySort_ ? bucket.ySorted_ : visible_) {
+            const auto &drawable = bucket.drawables_[index];
+            ScopedCost cost(CostAttribution::Phase::Draw, *drawable.entity_);
+            drawable.entity_->DrawTo(renderTarget);
+        }
+    }
+}
+
+// Puts the visible drawables in visible_ as runs in add order, one for each cell and one for the moving drawables
+void DrawHandler::CollectVisible(Bucket &bucket, const sf::FloatRect &visibleArea)
+{
+    visible_.clear();
+    runStarts_.clear();
+    auto collect = [this, &bucket, &visibleArea](const std::vector<std::size_t> &indices) {
+        std::size_t runStart = visible_.size();
+        for (auto index : indices) {
+            auto &drawable = bucket.drawables_[index];
+            if (drawable.entity_ != nullptr && visibleArea.intersects(drawable.bounds_)) {
+                drawable.visibleFrame_ = frame_;
+                visible_.push_back(index);
+            }
+        }
+        if (visible_.size() > runStart) runStarts_.push_back(runStart);
+    };
+
+    // Drawables are put in the cell of their top left corner, so cells up and left of the area can reach into it
+    int firstRow = static_cast<int>(std::floor((visibleArea.top - bucket.maxOverhang_) / cellSize_));
+    int lastRow = static_cast<int>(std::floor((visibleArea.top + visibleArea.height) / cellSize_));
+    int firstColumn = static_cast<int>(std::floor((visibleArea.left - bucket.maxOverhang_) / cellSize_));
+    int lastColumn = static_cast<int>(std::floor((visibleArea.left + visibleArea.width) / cellSize_));
+    for (int row = firstRow; row <= lastRow; row++) {
+        auto it = bucket.cells_.lower_bound({row, firstColumn});
+        auto end = bucket.cells_.upper_bound({row, lastColumn});
+        for (; it != end; ++it) {
+            collect(it->second);
+        }
+    }
+
+    for (auto index : bucket.moving_) {
+        auto &drawable = bucket.drawables_[index];
+        if (drawable.entity_ != nullptr) drawable.bounds_ = drawable.entity_->GetDrawBounds();
+    }
+    collect(bucket.moving_);
+}
+
+// Merges neighbouring runs of visible_ pairwise until one run is left, in log2(runs) passes
+void DrawHandler::MergeRuns()
+{
+    while (runStarts_.size() > 1) {
+        std::size_t nRuns = runStarts_.size();
+        runStarts_.push_back(visible_.size());
+        merged_.clear();
+        std::size_t nMerged = 0;
+        for (std::size_t i = 0; i < nRuns; i += 2) {
+            auto first = visible_.begin() + runStarts_[i];
+            auto middle = visible_.begin() + runStarts_[std::min(i + 1, nRuns)];
+            auto last = visible_.begin() + runStarts_[std::min(i + 2, nRuns)];
+            runStarts_[nMerged++] = merged_.size();
+            std::merge(first, middle, middle, last, std::back_inserter(merged_));
+        }
+        runStarts_.resize(nMerged);
+        visible_.swap(merged_);
     }
 }
 
-void DrawHandler::DrawTo(Graphic::RenderTargetIf &renderTarget) const
+// Drawables still visible keep their place from the last frame and the others are put last, then it is insertion
+// sorted. That is near linear, as only drawables that passed each other or came into view are out of place.
+void DrawHandler::SortOnBottom(Bucket &bucket)
 {
-    for (auto p : drawables_) {
-        auto id = p.second.id_;
-        entityDb_.GetEntity(id).DrawTo(renderTarget);
+    auto &drawables = bucket.drawables_;
+    merged_.clear();
+    for (auto index : bucket.ySorted_) {
+        auto &drawable = drawables[index];
+        if (drawable.entity_ != nullptr && drawable.visibleFrame_ == frame_) {
+            drawable.sortedFrame_ = frame_;
+            merged_.push_back(index);
+        }
+    }
+    for (auto index : visible_) {
+        if (drawables[index].sortedFrame_ != frame_) merged_.push_back(index);
+    }
+
+    // on the same bottom the one added first is drawn first
+    auto drawsBefore = [&drawables](std::size_t a, std::size_t b) {
+        float bottomA = Bottom(drawables[a].bounds_);
+        float bottomB = Bottom(drawables[b].bounds_);
+        return bottomA != bottomB ? bottomA < bottomB : a < b;
+    };
+    for (std::size_t i = 1; i < merged_.size(); i++) {
+        auto index = merged_[i];
+        auto j = i;
+        for (; j > 0 && drawsBefore(index, merged_[j - 1]); j--) {
+            merged_[j] = merged_[j - 1];
+        }
+        merged_[j] = index;
+    }
+    bucket.ySorted_.swap(merged_);
+}
+
+// Drops removed drawables without changing the order of the others, and moves their handles to the new positions
+void DrawHandler::Compact(Bucket &bucket)
+{
+    std::vector<std::size_t> newIndices(bucket.drawables_.size(), removedIndex);
+    std::size_t nKept = 0;
+    for (std::size_t i = 0; i < bucket.drawables_.size(); i++) {
+        const auto &drawable = bucket.drawables_[i];
+        if (drawable.entity_ == nullptr) continue;
+        newIndices[i] = nKept;
+        handles_[drawable.id_].index_ = nKept;
+        bucket.drawables_[nKept++] = drawable;
+    }
+    bucket.drawables_.resize(nKept);
+    bucket.nRemoved_ = 0;
+
+    auto remap = [&newIndices](std::vector<std::size_t> &indices) {
+        indices.erase(std::remove_if(indices.begin(), indices.end(),
+                                     [&newIndices](std::size_t index) { return newIndices[index] == removedIndex; }),
+                      indices.end());
+        for (auto &index : indices) {
+            index = newIndices[index];
+        }
+    };
+    remap(bucket.moving_);
+    remap(bucket.ySorted_);
+    for (auto it = bucket.cells_.begin(); it != bucket.cells_.end();) {
+        remap(it->second);
+        it = it->second.empty() ? bucket.cells_.erase(it) : std::next(it);
     }
 }
 
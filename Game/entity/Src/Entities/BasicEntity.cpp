@@ -36,6 +36,8 @@ void BasicEntity::InitCB()
 {
     RegisterProperties();
     body_.position_ = data_.position_;
+    body_.prevPosition_ = body_.position_;
+    body_.renderPosition_ = body_.position_;
     body_.scale_ = 1.0;
     body_.rotation_ = 0.0;
     ReadProperties(data_.properties_);
@@ -69,14 +71,26 @@ void BasicEntity::Destroy()
 
 void BasicEntity::Update(float deltaTime)
 {
+    body_.prevPosition_ = body_.position_;
     stateMachine_.Update(deltaTime);
 }
 
+void BasicEntity::Interpolate(float alpha)
+{
+    body_.renderPosition_ = body_.prevPosition_ + (body_.position_ - body_.prevPosition_) * alpha;
+    stateMachine_.Interpolate();
+}
+
 void BasicEntity::DrawTo(Graphic::RenderTargetIf& renderTarget) const
 {
     stateMachine_.GetShape().DrawTo(renderTarget);
 }
 
+sf::FloatRect BasicEntity::GetDrawBounds() const
+{
+    return stateMachine_.GetShape().GetDrawBounds();
+}
+
 bool BasicEntity::Intersect(const EntityIf& otherEntity) const
 {
     const auto& other = static_cast<const BasicEntity&>(otherEntity);
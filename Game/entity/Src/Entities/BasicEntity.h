@@ -43,7 +43,9 @@ public:
     void Destroy() final;
     void Init() final;
     void Update(float deltaTime) final;
+    void Interpolate(float alpha) final;
     void DrawTo(Graphic::RenderTargetIf& renderTarget) const final;
+    sf::FloatRect GetDrawBounds() const final;
     bool Intersect(const EntityIf& otherEntity) const final;
     bool IsOutsideTileMap(const sf::FloatRect& rect) const final;
     void HandleCollision(const EntityId id) final;
@@ -334,7 +334,7 @@ void PlayerEntity::RegisterStates(std::shared_ptr<State> idleState, std::shared_
 void PlayerEntity::OnInit()
 {
     auto& cameraView = service_->GetCameraView();
-    cameraView.SetTrackPoint(body_.position_);
+    cameraView.SetTrackPoint(body_.renderPosition_);
 }
 
 void PlayerEntity::DefineIdleState(std::shared_ptr<State> state)
@@ -439,7 +439,7 @@ void PlayerEntity::DefineDoorMoveState(std::shared_ptr<State> state)
                 cameraView.SetFixPoint(exitPos);
             }
             else if (state == DoorMoveAbility::State::Done) {
-                cameraView.SetTrackPoint(body_.position_);
+                cameraView.SetTrackPoint(body_.renderPosition_);
                 ChangeStateTo(StateType::Idle, nullptr);
             }
         });
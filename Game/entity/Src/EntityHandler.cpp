@@ -8,15 +8,34 @@
 
 #include <memory>
 
+#include "CommandBuffer.h"
+#include "CostAttribution.h"
 #include "EntityDb.h"
 #include "EntityIf.h"
 #include "EntityService.h"
 #include "Factory.h"
+#include "JobSystem.h"
 
 namespace FA {
 
 namespace Entity {
 
+namespace {
+
+std::size_t updateChunkSize = 256;
+
+}  // namespace
+
+void SetEntityUpdateChunkSize(std::size_t chunkSize)
+{
+    updateChunkSize = chunkSize;
+}
+
+std::size_t GetEntityUpdateChunkSize()
+{
+    return updateChunkSize;
+}
+
 EntityHandler::EntityHandler(EntityDb &entityDb)
     : entityDb_(entityDb)
 {}
@@ -24,9 +43,45 @@ EntityHandler::EntityHandler(EntityDb &entityDb)
 EntityHandler::~EntityHandler() = default;
 
 void EntityHandler::Update(float deltaTime)
+{
+    // Chunks cover the entities in the same order as a serial update, and their command buffers are applied in chunk
+    // order, so the result does not depend on which worker runs which chunk. The serial update defers to one buffer,
+    // so side effects are applied at the same point for every chunk size.
+    updateOrder_.assign(allEntities_.begin(), allEntities_.end());
+    auto chunkSize = updateChunkSize;
+    if (chunkSize == 0) {
+        commandBuffers_.resize(1);
+        CommandBuffer::Scope scope(commandBuffers_.front());
+        for (const auto id : updateOrder_) {
+            UpdateEntity(id, deltaTime);
+        }
+    }
+    else {
+        commandBuffers_.resize((updateOrder_.size() + chunkSize - 1) / chunkSize);
+        auto updateChunk = [&](std::size_t begin, std::size_t end) {
+            CommandBuffer::Scope scope(commandBuffers_[begin / chunkSize]);
+            for (auto i = begin; i < end; i++) {
+                UpdateEntity(updateOrder_[i], deltaTime);
+            }
+        };
+        Util::JobSystem::Instance().ParallelFor(updateOrder_.size(), chunkSize, updateChunk);
+    }
+    for (auto &buffer : commandBuffers_) {
+        buffer.Apply();
+    }
+}
+
+void EntityHandler::UpdateEntity(EntityId id, float deltaTime)
+{
+    auto &entity = entityDb_.GetEntity(id);
+    ScopedCost cost(CostAttribution::Phase::Update, entity);
+    entity.Update(deltaTime);
+}
+
+void EntityHandler::Interpolate(float alpha)
 {
     for (const auto id : allEntities_) {
-        entityDb_.GetEntity(id).Update(deltaTime);
+        entityDb_.GetEntity(id).Interpolate(alpha);
     }
 }
 
@@ -37,7 +92,11 @@ EntityId EntityHandler::AddEntity(const Shared::EntityData &data, const Factory
 {
     auto service = std::make_unique<Entity::EntityService>(messageBus, textureManager, sheetManager, cameraViews,
                                                            entityDb_, entityLifeHandler, objIdTranslator);
-    auto entity = factory.Create(data, std::move(service));
+    return AddEntity(factory.Create(data, std::move(service)));
+}
+
+EntityId EntityHandler::AddEntity(std::unique_ptr<EntityIf> entity)
+{
     entity->Init();
     auto id = entity->GetId();
     entityDb_.AddEntity(std::move(entity));
@@ -9,6 +9,7 @@
 #include "Animation/Animation.h"
 #include "CameraView.h"
 #include "CameraViews.h"
+#include "CommandBuffer.h"
 #include "Constant/Entity.h"
 #include "Entities/BasicEntity.h"
 #include "EntityDb.h"
@@ -113,6 +114,11 @@ std::shared_ptr<Shared::SequenceIf<Shared::ColliderFrame>> EntityService::Create
 
 void EntityService::SendMessage(std::shared_ptr<Shared::Message> msg)
 {
+    if (auto buffer = CommandBuffer::GetActive()) {
+        buffer->Add([this, msg]() { messageBus_.SendMessage(msg); });
+        return;
+    }
+
     messageBus_.SendMessage(msg);
 }
 
@@ -135,11 +141,21 @@ Shared::CameraView& EntityService::GetCameraView() const
 
 void EntityService::AddToCreationPool(const Shared::EntityData& data)
 {
+    if (auto buffer = CommandBuffer::GetActive()) {
+        buffer->Add([this, data]() { entityLifeHandler_.AddToCreationPool(data); });
+        return;
+    }
+
     entityLifeHandler_.AddToCreationPool(data);
 }
 
 void EntityService::AddToDeletionPool(EntityId id)
 {
+    if (auto buffer = CommandBuffer::GetActive()) {
+        buffer->Add([this, id]() { entityLifeHandler_.AddToDeletionPool(id); });
+        return;
+    }
+
     entityLifeHandler_.AddToDeletionPool(id);
 }
 
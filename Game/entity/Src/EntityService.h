@@ -58,14 +58,15 @@ public:
     std::shared_ptr<Shared::AnimationIf<Shared::ColliderFrame>> CreateColliderAnimation(
         const std::vector<Shared::ColliderData> &colliders, bool center = true);
 
+    // Deferred to the active command buffer of the calling thread, if any
     void SendMessage(std::shared_ptr<Shared::Message> msg);
     void AddSubscriber(const std::string &subscriber, const std::vector<Shared::MessageType> &messageTypes,
                        std::function<void(std::shared_ptr<Shared::Message>)> onMessage);
 
     void RemoveSubscriber(const std::string &subscriber, const std::vector<Shared::MessageType> &messageTypes);
     Shared::CameraView &GetCameraView() const;
-    void AddToCreationPool(const Shared::EntityData &data);
-    void AddToDeletionPool(EntityId id);
+    void AddToCreationPool(const Shared::EntityData &data);  // deferred like SendMessage
+    void AddToDeletionPool(EntityId id);                      // deferred like SendMessage
     EntityIf &GetEntity(EntityId id) const;
     EntityId ObjIdToEntityId(int objId) const;
 
@@ -4,6 +4,8 @@
  *	See file LICENSE for full license details.
  */
 
+#define FA_LOG_CHANNEL FA::Shared::LogChannel::Entity
+
 #include "Factory.h"
 
 #include "Entities/ArrowEntity.h"
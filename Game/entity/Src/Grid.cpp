@@ -4,6 +4,8 @@
  *	See file LICENSE for full license details.
  */
 
+#define FA_LOG_CHANNEL FA::Shared::LogChannel::Entity
+
 #include "Grid.h"
 
 #include <SFML/System/Vector2.hpp>
@@ -6,6 +6,8 @@
 
 #include "Shape.h"
 
+#include <algorithm>
+
 #include <SFML/Graphics/Color.hpp>
 #include <SFML/Graphics/Rect.hpp>
 
@@ -75,6 +77,18 @@ void Shape::Update(float deltaTime)
 #endif  // _DEBUG
 }
 
+// Colliders stay at the simulated position, only what is drawn follows the render position
+void Shape::Interpolate()
+{
+    for (auto &sprite : sprites_) {
+        sprite->setPosition(body_.renderPosition_);
+    }
+
+#ifdef _DEBUG
+    rShape_.setPosition(body_.renderPosition_);
+#endif  // _DEBUG
+}
+
 std::shared_ptr<Graphic::SpriteIf> Shape::RegisterSprite()
 {
     auto sprite = std::make_shared<Graphic::Sprite>();
@@ -124,6 +138,37 @@ void Shape::DrawTo(Graphic::RenderTargetIf &renderTarget) const
 #endif
 }
 
+// Union of everything DrawTo draws, in world coordinates
+sf::FloatRect Shape::GetDrawBounds() const
+{
+    sf::FloatRect bounds{body_.renderPosition_, {0.0f, 0.0f}};
+    bool first = true;
+    auto add = [&bounds, &first](const sf::FloatRect &rect) {
+        if (first) {
+            bounds = rect;
+            first = false;
+            return;
+        }
+        float left = std::min(bounds.left, rect.left);
+        float top = std::min(bounds.top, rect.top);
+        float right = std::max(bounds.left + bounds.width, rect.left + rect.width);
+        float bottom = std::max(bounds.top + bounds.height, rect.top + rect.height);
+        bounds = {left, top, right - left, bottom - top};
+    };
+
+    for (auto &sprite : sprites_) {
+        add(sprite->getGlobalBounds());
+    }
+#ifdef _DEBUG
+    for (auto &element : colliders_) {
+        add(element.rect_->getGlobalBounds());
+    }
+    add(rShape_.getGlobalBounds());
+#endif
+
+    return bounds;
+}
+
 bool Shape::Intersect(const Shape &otherShape) const
 {
     bool intersect = false;
@@ -9,6 +9,8 @@
 #include <memory>
 #include <vector>
 
+#include "SfmlFwd.h"
+
 #ifdef _DEBUG
 #include "RectangleShape.h"
 #endif
@@ -50,7 +52,9 @@ public:
     void RegisterColliderAnimator(std::shared_ptr<AnimatorIf<Shared::ColliderFrame>> animator);
     void Enter();
     void Update(float deltaTime);
+    void Interpolate();
     void DrawTo(Graphic::RenderTargetIf &renderTarget) const;
+    sf::FloatRect GetDrawBounds() const;
     bool Intersect(const Shape &shape) const;
 
 private:
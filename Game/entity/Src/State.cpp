@@ -4,6 +4,8 @@
  *	See file LICENSE for full license details.
  */
 
+#define FA_LOG_CHANNEL FA::Shared::LogChannel::Entity
+
 #include "State.h"
 
 #include "Abilities/AbilityIf.h"
@@ -49,6 +51,11 @@ void State::Update(float deltaTime)
     shape_.Update(deltaTime);
 }
 
+void State::Interpolate()
+{
+    shape_.Interpolate();
+}
+
 void State::HandleEvent(std::shared_ptr<BasicEvent> event)
 {
     if (!ignoreAllEvents_ || (notIgnorableEventTypes_.find(event->GetEventType()) != notIgnorableEventTypes_.end())) {
@@ -53,6 +53,7 @@ public:
     void Enter(std::shared_ptr<BasicEvent> event);
     void Exit();
     void Update(float deltaTime);
+    void Interpolate();
     void HandleEvent(std::shared_ptr<BasicEvent> event);
     StateType GetStateType() const { return stateType_; }
     void RegisterEnterCB(std::function<void()> enterCB);
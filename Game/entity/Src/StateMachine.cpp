@@ -37,6 +37,11 @@ void StateMachine::Update(float deltaTime)
     currentState_->Update(deltaTime);
 }
 
+void StateMachine::Interpolate()
+{
+    currentState_->Interpolate();
+}
+
 std::shared_ptr<State> StateMachine::RegisterState(StateType stateType, Body& body)
 {
     auto state = std::make_shared<State>(stateType, body);
@@ -37,6 +37,7 @@ public:
 
     void HandleEvent(std::shared_ptr<BasicEvent> event);
     void Update(float deltaTime);
+    void Interpolate();
     void ChangeStateTo(StateType nextStateType, std::shared_ptr<BasicEvent> event);
     const Shape& GetShape() const;
 
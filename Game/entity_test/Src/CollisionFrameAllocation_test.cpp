@@ -0,0 +1,147 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <memory>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <SFML/Graphics/Rect.hpp>
+
+#include "AllocationTracker.h"
+#include "CollisionHandler.h"
+#include "EntityDb.h"
+#include "EntityIf.h"
+#include "Grid.h"
+
+using namespace testing;
+
+namespace FA {
+
+namespace Entity {
+
+namespace {
+
+// Entity with a collision box only. EntityMock would allocate in gmock on every call.
+class BoxEntity : public EntityIf
+{
+public:
+    BoxEntity(EntityId id, const sf::FloatRect& rect)
+        : id_(id)
+        , rect_(rect)
+    {}
+
+    virtual EntityType Type() const override { return EntityType::Mole; }
+    virtual LayerType GetLayer() const override { return LayerType::Ground; }
+    virtual bool IsStatic() const override { return false; }
+    virtual bool IsSolid() const override { return false; }
+    virtual void Destroy() override {}
+    virtual void Init() override {}
+    virtual void Update(float deltaTime) override {}
+    virtual void Interpolate(float alpha) override {}
+    virtual void DrawTo(Graphic::RenderTargetIf& renderTarget) const override {}
+    virtual sf::FloatRect GetDrawBounds() const override { return rect_; }
+    virtual bool Intersect(const EntityIf& otherEntity) const override
+    {
+        return rect_.intersects(static_cast<const BoxEntity&>(otherEntity).rect_);
+    }
+    virtual bool IsOutsideTileMap(const sf::FloatRect& rect) const override { return !rect.intersects(rect_); }
+    virtual void HandleCollision(const EntityId id) override { nCollisions_++; }
+    virtual void HandleOutsideTileMap() override {}
+    virtual EntityId GetId() const override { return id_; }
+
+    unsigned int nCollisions_{};
+
+private:
+    EntityId id_{};
+    sf::FloatRect rect_;
+};
+
+}  // namespace
+
+// Runs the collision part of a level frame on a real EntityDb, CollisionHandler2 and Grid, and reads the allocations
+// of each frame from EndAllocationFrame.
+class CollisionFrameAllocationTest : public Test
+{
+protected:
+    CollisionFrameAllocationTest()
+        : collisionHandler_(entityDb_)
+        , grid_(mapSize_, cellSize_, entityDb_, collisionHandler_)
+    {}
+
+    void SetUp() override { Util::EnableAllocationTracking(true); }
+    void TearDown() override { Util::EnableAllocationTracking(false); }
+
+    void AddEntity(EntityId id, const sf::Vector2f& position)
+    {
+        sf::FloatRect rect(position, static_cast<sf::Vector2f>(size_));
+        auto entity = std::make_unique<BoxEntity>(id, rect);
+        entities_.push_back(entity.get());
+        entityDb_.AddEntity(std::move(entity));
+        grid_.Add(id, position, size_);
+    }
+
+    // Fills the caches, the next EndAllocationFrame covers the first steady state frame only
+    void WarmUp()
+    {
+        RunFrame();
+        Util::EndAllocationFrame();
+    }
+
+    void RunFrame()
+    {
+        grid_.DetectCollisions();
+        grid_.HandleCollisions();
+    }
+
+    const sf::Vector2u mapSize_{1000, 1000};
+    const unsigned int cellSize_ = 100;
+    const sf::Vector2u size_{16, 16};
+    EntityDb entityDb_;
+    CollisionHandler2 collisionHandler_;
+    Grid grid_;
+    std::vector<BoxEntity*> entities_;
+};
+
+TEST_F(CollisionFrameAllocationTest, FrameWithoutCollisionsShouldNotAllocate)
+{
+    AddEntity(1, {10.0f, 10.0f});
+    AddEntity(2, {50.0f, 50.0f});
+    AddEntity(3, {510.0f, 10.0f});
+    WarmUp();
+
+    for (int frame = 0; frame < 10; frame++) {
+        RunFrame();
+        Util::EndAllocationFrame();
+
+        EXPECT_EQ(Util::GetFrameAllocationStats(), Util::AllocationStats());
+    }
+}
+
+TEST_F(CollisionFrameAllocationTest, SteadyStateFrameShouldOnlyAllocateCollisionPairs)
+{
+    AddEntity(1, {10.0f, 10.0f});
+    AddEntity(2, {20.0f, 20.0f});
+    AddEntity(3, {510.0f, 10.0f});
+    AddEntity(4, {520.0f, 10.0f});
+    AddEntity(5, {300.0f, 300.0f});
+    const std::size_t budget = 2;  // one set node per colliding pair
+    WarmUp();
+
+    for (int frame = 0; frame < 10; frame++) {
+        RunFrame();
+        Util::EndAllocationFrame();
+
+        EXPECT_EQ(Util::GetFrameAllocationStats().nAllocations_, budget);
+    }
+    EXPECT_EQ(entities_[0]->nCollisions_, 11u);
+    EXPECT_EQ(entities_[4]->nCollisions_, 0u);
+}
+
+}  // namespace Entity
+
+}  // namespace FA
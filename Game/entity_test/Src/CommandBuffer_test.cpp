@@ -0,0 +1,61 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "CommandBuffer.h"
+
+using namespace testing;
+
+namespace FA {
+
+namespace Entity {
+
+TEST(CommandBufferTest, ApplyShouldRunCommandsInAddedOrderAndClear)
+{
+    CommandBuffer buffer;
+    std::vector<int> order;
+    buffer.Add([&order]() { order.push_back(1); });
+    buffer.Add([&order]() { order.push_back(2); });
+    buffer.Add([&order]() { order.push_back(3); });
+
+    buffer.Apply();
+
+    EXPECT_THAT(order, ElementsAre(1, 2, 3));
+    EXPECT_EQ(buffer.GetCount(), 0u);
+}
+
+TEST(CommandBufferTest, ScopeShouldSetActiveBufferOfCallingThread)
+{
+    CommandBuffer outer;
+    CommandBuffer inner;
+    EXPECT_EQ(CommandBuffer::GetActive(), nullptr);
+
+    {
+        CommandBuffer::Scope outerScope(outer);
+        EXPECT_EQ(CommandBuffer::GetActive(), &outer);
+        {
+            CommandBuffer::Scope innerScope(inner);
+            EXPECT_EQ(CommandBuffer::GetActive(), &inner);
+        }
+        EXPECT_EQ(CommandBuffer::GetActive(), &outer);
+
+        CommandBuffer* otherThreadBuffer = &outer;
+        std::thread thread([&otherThreadBuffer]() { otherThreadBuffer = CommandBuffer::GetActive(); });
+        thread.join();
+        EXPECT_EQ(otherThreadBuffer, nullptr);
+    }
+
+    EXPECT_EQ(CommandBuffer::GetActive(), nullptr);
+}
+
+}  // namespace Entity
+
+}  // namespace FA
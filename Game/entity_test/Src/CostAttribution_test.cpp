@@ -0,0 +1,149 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <sstream>
+#include <thread>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "EntityMock.h"
+
+#include "CostAttribution.h"
+
+using namespace testing;
+
+namespace FA {
+
+namespace Entity {
+
+class CostAttributionTest : public Test
+{
+protected:
+    void SetUp() override
+    {
+        costAttribution_.Clear();
+        costAttribution_.Enable(true, 2);
+    }
+
+    void TearDown() override
+    {
+        costAttribution_.Enable(false);
+        costAttribution_.Clear();
+    }
+
+    CostAttribution &costAttribution_ = CostAttribution::Instance();
+};
+
+TEST_F(CostAttributionTest, EndFrameShouldReturnCostsPerTypeAndPhase)
+{
+    costAttribution_.Add(CostAttribution::Phase::Update, EntityType::Mole, 1, 0.5);
+    costAttribution_.Add(CostAttribution::Phase::Update, EntityType::Mole, 2, 0.25);
+    costAttribution_.Add(CostAttribution::Phase::Draw, EntityType::Arrow, 3, 0.125);
+    costAttribution_.EndFrame();
+
+    const auto &costs = costAttribution_.GetFrameCosts();
+    ASSERT_THAT(costs, SizeIs(2));
+    const auto &update = costs.at(EntityType::Mole)[static_cast<std::size_t>(CostAttribution::Phase::Update)];
+    EXPECT_DOUBLE_EQ(update.ms_, 0.75);
+    EXPECT_EQ(update.nCalls_, 2u);
+    const auto &draw = costs.at(EntityType::Arrow)[static_cast<std::size_t>(CostAttribution::Phase::Draw)];
+    EXPECT_DOUBLE_EQ(draw.ms_, 0.125);
+    EXPECT_EQ(draw.nCalls_, 1u);
+}
+
+TEST_F(CostAttributionTest, EndFrameShouldStartNewFrameAndAccumulateTotal)
+{
+    costAttribution_.Add(CostAttribution::Phase::Collision, EntityType::Rect, 1, 1.0);
+    costAttribution_.EndFrame();
+    costAttribution_.Add(CostAttribution::Phase::Collision, EntityType::Rect, 1, 2.0);
+    costAttribution_.EndFrame();
+    costAttribution_.EndFrame();
+
+    EXPECT_THAT(costAttribution_.GetFrameCosts(), IsEmpty());
+    const auto &totalCosts = costAttribution_.GetTotalCosts().at(EntityType::Rect);
+    const auto &total = totalCosts[static_cast<std::size_t>(CostAttribution::Phase::Collision)];
+    EXPECT_DOUBLE_EQ(total.ms_, 3.0);
+    EXPECT_EQ(total.nCalls_, 2u);
+    EXPECT_EQ(costAttribution_.GetFrameCount(), 3u);
+}
+
+TEST_F(CostAttributionTest, TopEntitiesShouldBeSortedByCostOfAllPhases)
+{
+    costAttribution_.Add(CostAttribution::Phase::Update, EntityType::Mole, 1, 1.0);
+    costAttribution_.Add(CostAttribution::Phase::Update, EntityType::Mole, 2, 2.0);
+    costAttribution_.Add(CostAttribution::Phase::Draw, EntityType::Mole, 1, 2.0);
+    costAttribution_.Add(CostAttribution::Phase::Update, EntityType::Coin, 3, 0.5);
+    costAttribution_.EndFrame();
+
+    const auto &top = costAttribution_.GetTopEntities();
+    ASSERT_THAT(top, SizeIs(2));
+    EXPECT_EQ(top[0].id_, 1);
+    EXPECT_DOUBLE_EQ(top[0].ms_, 3.0);
+    EXPECT_EQ(top[1].id_, 2);
+}
+
+TEST_F(CostAttributionTest, EndFrameShouldMergeCostsAddedFromOtherThreads)
+{
+    costAttribution_.Add(CostAttribution::Phase::Draw, EntityType::Mole, 1, 1.0);
+    std::thread t([this]() {
+        costAttribution_.Add(CostAttribution::Phase::Update, EntityType::Mole, 1, 2.0);
+        costAttribution_.Add(CostAttribution::Phase::Update, EntityType::Mole, 2, 0.5);
+    });
+    t.join();
+    costAttribution_.EndFrame();
+
+    const auto &costs = costAttribution_.GetFrameCosts().at(EntityType::Mole);
+    EXPECT_DOUBLE_EQ(costs[static_cast<std::size_t>(CostAttribution::Phase::Update)].ms_, 2.5);
+    EXPECT_EQ(costs[static_cast<std::size_t>(CostAttribution::Phase::Update)].nCalls_, 2u);
+    EXPECT_EQ(costs[static_cast<std::size_t>(CostAttribution::Phase::Draw)].nCalls_, 1u);
+    const auto &top = costAttribution_.GetTopEntities();
+    ASSERT_THAT(top, SizeIs(2));
+    EXPECT_EQ(top[0].id_, 1);
+    EXPECT_DOUBLE_EQ(top[0].ms_, 3.0);
+}
+
+TEST_F(CostAttributionTest, WriteCsvShouldWriteOneRowPerTypeAndPhase)
+{
+    costAttribution_.Add(CostAttribution::Phase::Update, EntityType::Player, 1, 2.0);
+    costAttribution_.EndFrame();
+    costAttribution_.EndFrame();
+    std::stringstream ss;
+    costAttribution_.WriteCsv(ss);
+
+    EXPECT_THAT(ss.str(), StrEq("type,phase,calls,total_ms,ms_per_frame\nPlayer,Update,1,2,1\n"));
+}
+
+TEST_F(CostAttributionTest, ScopedCostShouldAddCostOfEntity)
+{
+    StrictMock<EntityMock> entityMock;
+    EXPECT_CALL(entityMock, Type()).WillOnce(Return(EntityType::Arrow));
+    EXPECT_CALL(entityMock, GetId()).WillOnce(Return(7));
+    {
+        ScopedCost cost(CostAttribution::Phase::Update, entityMock);
+    }
+    costAttribution_.EndFrame();
+
+    const auto &costs = costAttribution_.GetFrameCosts();
+    ASSERT_THAT(costs, SizeIs(1));
+    EXPECT_EQ(costs.at(EntityType::Arrow)[0].nCalls_, 1u);
+}
+
+TEST_F(CostAttributionTest, ScopedCostShouldDoNothingWhenDisabled)
+{
+    StrictMock<EntityMock> entityMock;
+    costAttribution_.Enable(false);
+    {
+        ScopedCost cost(CostAttribution::Phase::Update, entityMock);
+    }
+    costAttribution_.EndFrame();
+
+    EXPECT_THAT(costAttribution_.GetFrameCosts(), IsEmpty());
+}
+
+}  // namespace Entity
+
+}  // namespace FA
@@ -0,0 +1,223 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <memory>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <SFML/Graphics/Rect.hpp>
+
+#include "DrawHandler.h"
+#include "EntityDb.h"
+#include "EntityMock.h"
+#include "RenderTargetMock.h"
+
+using namespace testing;
+
+namespace FA {
+
+namespace Entity {
+
+class DrawHandlerTest : public Test
+{
+protected:
+    DrawHandlerTest()
+        : drawHandler_(db_, cellSize_)
+    {
+        AddEntity(entityMock1_, 1);
+        AddEntity(entityMock2_, 2);
+    }
+
+    void AddStaticEntity(StrictMock<EntityMock>& mock, EntityId id, const sf::FloatRect& bounds)
+    {
+        EXPECT_CALL(mock, IsStatic()).WillRepeatedly(Return(true));
+        EXPECT_CALL(mock, GetDrawBounds()).WillOnce(Return(bounds));
+        AddToDb(mock, id);
+    }
+
+    const float cellSize_ = 100.0f;
+    const sf::FloatRect outsideBounds_{500.0f, 10.0f, 16.0f, 16.0f};
+    StrictMock<EntityMock> entityMock1_;
+    StrictMock<EntityMock> entityMock2_;
+    StrictMock<EntityMock> staticMock1_;
+    StrictMock<EntityMock> staticMock2_;
+    StrictMock<Graphic::RenderTargetMock> renderTargetMock_;
+    // Declare EntityDb db_ after entityMocks, otherwise EntityDb destructor will execute using destroyed entityMocks
+    EntityDb db_;
+    DrawHandler drawHandler_;
+
+private:
+    void AddEntity(StrictMock<EntityMock>& mock, EntityId id)
+    {
+        EXPECT_CALL(mock, IsStatic()).WillRepeatedly(Return(false));
+        AddToDb(mock, id);
+    }
+
+    void AddToDb(StrictMock<EntityMock>& mock, EntityId id)
+    {
+        EXPECT_CALL(mock, GetId()).WillRepeatedly(Return(id));
+        EXPECT_CALL(mock, GetLayer()).WillRepeatedly(Return(LayerType::Ground));
+        EXPECT_CALL(mock, Destroy());
+        db_.AddEntity(std::make_unique<EntityMockProxy>(mock));
+        drawHandler_.AddDrawable(id);
+    }
+};
+
+TEST_F(DrawHandlerTest, DrawToShouldOnlyDrawEntitiesInsideVisibleArea)
+{
+    EXPECT_CALL(entityMock1_, GetDrawBounds()).WillOnce(Return(sf::FloatRect{10.0f, 10.0f, 16.0f, 16.0f}));
+    EXPECT_CALL(entityMock2_, GetDrawBounds()).WillOnce(Return(sf::FloatRect{500.0f, 10.0f, 16.0f, 16.0f}));
+    EXPECT_CALL(entityMock1_, DrawTo(Ref(renderTargetMock_)));
+
+    drawHandler_.DrawTo(renderTargetMock_, {0.0f, 0.0f, 400.0f, 300.0f});
+}
+
+TEST_F(DrawHandlerTest, DrawToShouldDrawEntitiesPartlyInsideVisibleArea)
+{
+    EXPECT_CALL(entityMock1_, GetDrawBounds()).WillOnce(Return(sf::FloatRect{-8.0f, 10.0f, 16.0f, 16.0f}));
+    EXPECT_CALL(entityMock2_, GetDrawBounds()).WillOnce(Return(sf::FloatRect{392.0f, 292.0f, 16.0f, 16.0f}));
+    EXPECT_CALL(entityMock1_, DrawTo(Ref(renderTargetMock_)));
+    EXPECT_CALL(entityMock2_, DrawTo(Ref(renderTargetMock_)));
+
+    drawHandler_.DrawTo(renderTargetMock_, {0.0f, 0.0f, 400.0f, 300.0f});
+}
+
+TEST_F(DrawHandlerTest, DrawToShouldNotDrawRemovedEntity)
+{
+    drawHandler_.RemoveDrawable(1);
+    EXPECT_CALL(entityMock2_, GetDrawBounds()).WillOnce(Return(sf::FloatRect{10.0f, 10.0f, 16.0f, 16.0f}));
+    EXPECT_CALL(entityMock2_, DrawTo(Ref(renderTargetMock_)));
+
+    drawHandler_.DrawTo(renderTargetMock_, {0.0f, 0.0f, 400.0f, 300.0f});
+}
+
+TEST_F(DrawHandlerTest, DrawToShouldDrawLowerEntityLastWhenYSortIsEnabled)
+{
+    drawHandler_.EnableYSort(LayerType::Ground);
+    EXPECT_CALL(entityMock1_, GetDrawBounds()).WillRepeatedly(Return(sf::FloatRect{10.0f, 100.0f, 16.0f, 16.0f}));
+    EXPECT_CALL(entityMock2_, GetDrawBounds()).WillRepeatedly(Return(sf::FloatRect{10.0f, 50.0f, 16.0f, 16.0f}));
+    {
+        InSequence seq;
+        EXPECT_CALL(entityMock2_, DrawTo(Ref(renderTargetMock_)));
+        EXPECT_CALL(entityMock1_, DrawTo(Ref(renderTargetMock_)));
+    }
+    drawHandler_.DrawTo(renderTargetMock_, {0.0f, 0.0f, 400.0f, 300.0f});
+
+    // removing after a sort should remove the right entity
+    drawHandler_.RemoveDrawable(2);
+    EXPECT_CALL(entityMock1_, DrawTo(Ref(renderTargetMock_)));
+    drawHandler_.DrawTo(renderTargetMock_, {0.0f, 0.0f, 400.0f, 300.0f});
+}
+
+TEST_F(DrawHandlerTest, DrawToShouldOnlyReadDrawBoundsOfMovingEntities)
+{
+    AddStaticEntity(staticMock1_, 3, {10.0f, 10.0f, 16.0f, 16.0f});
+    AddStaticEntity(staticMock2_, 4, {2000.0f, 10.0f, 16.0f, 16.0f});
+    EXPECT_CALL(entityMock1_, GetDrawBounds()).Times(2).WillRepeatedly(Return(outsideBounds_));
+    EXPECT_CALL(entityMock2_, GetDrawBounds()).Times(2).WillRepeatedly(Return(outsideBounds_));
+    EXPECT_CALL(staticMock1_, DrawTo(Ref(renderTargetMock_))).Times(2);
+
+    drawHandler_.DrawTo(renderTargetMock_, {0.0f, 0.0f, 400.0f, 300.0f});
+    drawHandler_.DrawTo(renderTargetMock_, {0.0f, 0.0f, 400.0f, 300.0f});
+}
+
+TEST_F(DrawHandlerTest, DrawToShouldDrawStaticEntityReachingIntoVisibleAreaFromOtherCell)
+{
+    AddStaticEntity(staticMock1_, 3, {90.0f, 10.0f, 40.0f, 16.0f});
+    EXPECT_CALL(entityMock1_, GetDrawBounds()).WillOnce(Return(outsideBounds_));
+    EXPECT_CALL(entityMock2_, GetDrawBounds()).WillOnce(Return(outsideBounds_));
+    EXPECT_CALL(staticMock1_, DrawTo(Ref(renderTargetMock_)));
+
+    drawHandler_.DrawTo(renderTargetMock_, {120.0f, 0.0f, 200.0f, 300.0f});
+}
+
+TEST_F(DrawHandlerTest, DrawToShouldNotDrawRemovedStaticEntity)
+{
+    AddStaticEntity(staticMock1_, 3, {10.0f, 10.0f, 16.0f, 16.0f});
+    AddStaticEntity(staticMock2_, 4, {20.0f, 20.0f, 16.0f, 16.0f});
+    drawHandler_.RemoveDrawable(3);
+    EXPECT_CALL(entityMock1_, GetDrawBounds()).WillOnce(Return(outsideBounds_));
+    EXPECT_CALL(entityMock2_, GetDrawBounds()).WillOnce(Return(outsideBounds_));
+    EXPECT_CALL(staticMock2_, DrawTo(Ref(renderTargetMock_)));
+
+    drawHandler_.DrawTo(renderTargetMock_, {0.0f, 0.0f, 400.0f, 300.0f});
+}
+
+TEST_F(DrawHandlerTest, DrawToShouldDrawInAddOrderAfterRemove)
+{
+    AddStaticEntity(staticMock1_, 3, {150.0f, 10.0f, 16.0f, 16.0f});
+    AddStaticEntity(staticMock2_, 4, {10.0f, 10.0f, 16.0f, 16.0f});
+    drawHandler_.RemoveDrawable(1);
+    EXPECT_CALL(entityMock2_, GetDrawBounds()).WillOnce(Return(sf::FloatRect{10.0f, 10.0f, 16.0f, 16.0f}));
+    {
+        InSequence seq;
+        EXPECT_CALL(entityMock2_, DrawTo(Ref(renderTargetMock_)));
+        EXPECT_CALL(staticMock1_, DrawTo(Ref(renderTargetMock_)));
+        EXPECT_CALL(staticMock2_, DrawTo(Ref(renderTargetMock_)));
+    }
+
+    drawHandler_.DrawTo(renderTargetMock_, {0.0f, 0.0f, 400.0f, 300.0f});
+}
+
+TEST_F(DrawHandlerTest, DrawToShouldDrawInAddOrderOnSameBottomWhenYSortIsEnabled)
+{
+    drawHandler_.EnableYSort(LayerType::Ground);
+    AddStaticEntity(staticMock1_, 3, {150.0f, 10.0f, 16.0f, 16.0f});
+    EXPECT_CALL(entityMock1_, GetDrawBounds()).WillOnce(Return(sf::FloatRect{10.0f, 10.0f, 16.0f, 16.0f}));
+    EXPECT_CALL(entityMock2_, GetDrawBounds()).WillOnce(Return(sf::FloatRect{10.0f, 0.0f, 16.0f, 16.0f}));
+    {
+        InSequence seq;
+        EXPECT_CALL(entityMock2_, DrawTo(Ref(renderTargetMock_)));
+        EXPECT_CALL(entityMock1_, DrawTo(Ref(renderTargetMock_)));
+        EXPECT_CALL(staticMock1_, DrawTo(Ref(renderTargetMock_)));
+    }
+
+    drawHandler_.DrawTo(renderTargetMock_, {0.0f, 0.0f, 400.0f, 300.0f});
+}
+
+TEST_F(DrawHandlerTest, DrawToShouldDrawLowerEntityLastAfterEntitiesPassEachOtherWhenYSortIsEnabled)
+{
+    drawHandler_.EnableYSort(LayerType::Ground);
+    EXPECT_CALL(entityMock1_, GetDrawBounds())
+        .WillOnce(Return(sf::FloatRect{10.0f, 100.0f, 16.0f, 16.0f}))
+        .WillOnce(Return(sf::FloatRect{10.0f, 40.0f, 16.0f, 16.0f}));
+    EXPECT_CALL(entityMock2_, GetDrawBounds()).WillRepeatedly(Return(sf::FloatRect{10.0f, 50.0f, 16.0f, 16.0f}));
+    {
+        InSequence seq;
+        EXPECT_CALL(entityMock2_, DrawTo(Ref(renderTargetMock_)));
+        EXPECT_CALL(entityMock1_, DrawTo(Ref(renderTargetMock_)));
+        EXPECT_CALL(entityMock1_, DrawTo(Ref(renderTargetMock_)));
+        EXPECT_CALL(entityMock2_, DrawTo(Ref(renderTargetMock_)));
+    }
+
+    drawHandler_.DrawTo(renderTargetMock_, {0.0f, 0.0f, 400.0f, 300.0f});
+    drawHandler_.DrawTo(renderTargetMock_, {0.0f, 0.0f, 400.0f, 300.0f});
+}
+
+TEST_F(DrawHandlerTest, DrawToShouldDrawInAddOrderAfterCompacting)
+{
+    AddStaticEntity(staticMock1_, 3, {150.0f, 10.0f, 16.0f, 16.0f});
+    AddStaticEntity(staticMock2_, 4, {10.0f, 10.0f, 16.0f, 16.0f});
+    // removing half of the drawables compacts them
+    drawHandler_.RemoveDrawable(1);
+    drawHandler_.RemoveDrawable(2);
+    {
+        InSequence seq;
+        EXPECT_CALL(staticMock1_, DrawTo(Ref(renderTargetMock_)));
+        EXPECT_CALL(staticMock2_, DrawTo(Ref(renderTargetMock_)));
+    }
+    drawHandler_.DrawTo(renderTargetMock_, {0.0f, 0.0f, 400.0f, 300.0f});
+
+    // removing after compacting should remove the right entity
+    drawHandler_.RemoveDrawable(4);
+    EXPECT_CALL(staticMock1_, DrawTo(Ref(renderTargetMock_)));
+    drawHandler_.DrawTo(renderTargetMock_, {0.0f, 0.0f, 400.0f, 300.0f});
+}
+
+}  // namespace Entity
+
+}  // namespace FA
@@ -0,0 +1,159 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <SFML/Graphics/Rect.hpp>
+
+#include "CommandBuffer.h"
+#include "EntityDb.h"
+#include "EntityHandler.h"
+#include "EntityIf.h"
+#include "JobSystem.h"
+
+using namespace testing;
+
+namespace FA {
+
+namespace Entity {
+
+namespace {
+
+struct World
+{
+    std::atomic<unsigned int> nUpdated_{0};
+    std::vector<std::string> messages_;
+};
+
+// Moves on each update and sends a message the way EntityService does, i.e. through the active command buffer
+class MovingEntity : public EntityIf
+{
+public:
+    MovingEntity(EntityId id, World& world)
+        : id_(id)
+        , world_(world)
+    {}
+
+    virtual EntityType Type() const override { return EntityType::Mole; }
+    virtual LayerType GetLayer() const override { return LayerType::Ground; }
+    virtual bool IsStatic() const override { return false; }
+    virtual bool IsSolid() const override { return false; }
+    virtual void Destroy() override {}
+    virtual void Init() override {}
+    virtual void Update(float deltaTime) override
+    {
+        position_ += id_ * deltaTime;
+        world_.nUpdated_++;
+        auto message = std::to_string(id_) + " at " + std::to_string(position_);
+        auto nUpdated = &world_.nUpdated_;
+        auto messages = &world_.messages_;
+        Send([message, nUpdated, messages]() { messages->push_back(message + " after " + std::to_string(*nUpdated)); });
+    }
+    virtual void Interpolate(float alpha) override {}
+    virtual void DrawTo(Graphic::RenderTargetIf& renderTarget) const override {}
+    virtual sf::FloatRect GetDrawBounds() const override { return {}; }
+    virtual bool Intersect(const EntityIf& otherEntity) const override { return false; }
+    virtual bool IsOutsideTileMap(const sf::FloatRect& rect) const override { return false; }
+    virtual void HandleCollision(const EntityId id) override {}
+    virtual void HandleOutsideTileMap() override {}
+    virtual EntityId GetId() const override { return id_; }
+
+    float position_{};
+
+private:
+    EntityId id_{};
+    World& world_;
+
+private:
+    void Send(CommandBuffer::Command command)
+    {
+        if (auto buffer = CommandBuffer::GetActive()) {
+            buffer->Add(std::move(command));
+            return;
+        }
+
+        command();
+    }
+};
+
+}  // namespace
+
+class EntityHandlerTest : public Test
+{
+protected:
+    void SetUp() override { prevChunkSize_ = GetEntityUpdateChunkSize(); }
+
+    void TearDown() override
+    {
+        SetEntityUpdateChunkSize(prevChunkSize_);
+        Util::JobSystem::Instance().Stop();
+    }
+
+    void AddEntities(EntityHandler& handler, World& world, std::vector<MovingEntity*>& entities)
+    {
+        for (EntityId id = 1; id <= nEntities_; id++) {
+            auto entity = std::make_unique<MovingEntity>(id, world);
+            entities.push_back(entity.get());
+            handler.AddEntity(std::move(entity));
+        }
+    }
+
+    // Runs frames with the chunk size and returns the entity positions
+    std::vector<float> RunFrames(std::size_t chunkSize, World& world)
+    {
+        SetEntityUpdateChunkSize(chunkSize);
+        EntityDb entityDb;
+        EntityHandler handler(entityDb);
+        std::vector<MovingEntity*> entities;
+        AddEntities(handler, world, entities);
+        for (int frame = 0; frame < nFrames_; frame++) {
+            handler.Update(0.5f);
+        }
+
+        std::vector<float> positions;
+        for (auto entity : entities) {
+            positions.push_back(entity->position_);
+        }
+        return positions;
+    }
+
+    const EntityId nEntities_ = 50;
+    const int nFrames_ = 4;
+    std::size_t prevChunkSize_{};
+};
+
+TEST_F(EntityHandlerTest, ChunkedUpdateShouldMatchSerialUpdate)
+{
+    World serialWorld;
+    auto serialPositions = RunFrames(0, serialWorld);
+    Util::JobSystem::Instance().Start(3);
+    World chunkedWorld;
+    auto chunkedPositions = RunFrames(7, chunkedWorld);
+
+    EXPECT_EQ(chunkedPositions, serialPositions);
+    EXPECT_EQ(chunkedWorld.messages_.size(), static_cast<std::size_t>(nEntities_ * nFrames_));
+    EXPECT_EQ(chunkedWorld.messages_, serialWorld.messages_);
+}
+
+TEST_F(EntityHandlerTest, SerialUpdateShouldSendMessagesAfterAllEntitiesAreUpdated)
+{
+    World world;
+    RunFrames(0, world);
+
+    ASSERT_EQ(world.messages_.size(), static_cast<std::size_t>(nEntities_ * nFrames_));
+    EXPECT_THAT(world.messages_.front(), EndsWith(" after " + std::to_string(nEntities_)));
+    EXPECT_THAT(world.messages_.back(), EndsWith(" after " + std::to_string(nEntities_ * nFrames_)));
+}
+
+}  // namespace Entity
+
+}  // namespace FA
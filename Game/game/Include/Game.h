@@ -6,15 +6,29 @@
 
 #pragma once
 
+#include "GameOptions.h"
+
 namespace FA {
 
+namespace Util {
+
+class FrameTimings;
+
+}  // namespace Util
+
 class Game
 {
 public:
+    explicit Game(const GameOptions& options = GameOptions());
+
     int Run();
 
 private:
-    void GameLoop();
+    GameOptions options_;
+
+private:
+    bool GameLoop(Util::FrameTimings* timings);  // false if allocation budget was exceeded
+    bool CheckFrameMetrics(const Util::FrameTimings& timings) const;
 };
 
 }  // namespace FA
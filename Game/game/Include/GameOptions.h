@@ -0,0 +1,51 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "LogFilter.h"
+
+namespace FA {
+
+struct GameOptions
+{
+    bool profile_ = false;
+    bool headless_ = false;     // null render backend, no window is opened
+    bool renderStats_ = false;  // count draw calls, texture switches and vertices, always on when headless
+    unsigned int nFrames_{};    // stop after this many frames, 0 means no limit
+    std::string recordPath_;    // input recording file to write
+    std::string replayPath_;    // input recording file to replay
+    bool hasSeed_ = false;
+    unsigned int seed_{};  // random seed when recording or running without replay
+    std::string metricsPath_;   // frame time percentiles to write
+    std::string baselinePath_;  // frame time percentiles to compare with
+    double tolerance_ = 0.1;
+    bool trackAllocations_ = false;
+    bool hasAllocationBudget_ = false;
+    unsigned int allocationBudget_{};  // max allocations in a frame after warmup frames
+    unsigned int nWarmupFrames_ = 120;
+    bool entityCosts_ = false;
+    unsigned int nTopEntities_{};  // entities with highest cost to show, 0 means none
+    unsigned int tickRate_ = 60;   // simulation steps per second, 0 means one variable step per frame
+    unsigned int maxSteps_ = 5;    // max simulation steps per frame
+    unsigned int fpsLimit_ = 120;  // max rendered frames per second, 0 means uncapped
+    bool hasWorkers_ = false;
+    unsigned int nWorkers_{};  // worker threads besides the main thread, default one less than hardware threads
+    bool hasEntityChunkSize_ = false;
+    unsigned int entityChunkSize_{};  // entities per parallel update job, 0 means serial update
+    bool pipelined_ = false;          // level update overlaps drawing of the previous frame
+    bool offscreenLayers_ = false;    // draw scene layers through textures also when no transition is running
+    bool hasLogLevel_ = false;
+    Util::LogLevel logLevel_{};
+    std::vector<Shared::LogChannel> mutedLogChannels_;
+};
+
+GameOptions ParseGameOptions(int argc, char* argv[]);
+
+}  // namespace FA
@@ -6,15 +6,35 @@
 
 #include "Game.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <ctime>
+#include <fstream>
+#include <stdexcept>
+
 #include <SFML/System/Clock.hpp>
 #include <SFML/Window/VideoMode.hpp>
 #include <SFML/Window/WindowStyle.hpp>
 #include <SFML/Graphics/View.hpp>
 
+#include "AllocationTracker.h"
+#include "CostAttribution.h"
+#include "EntityHandler.h"
+#include "Folder.h"
+#include "FrameMetrics.h"
+#include "InputRecording.h"
 #include "InputSystem.h"
+#include "JobSystem.h"
+#include "Level.h"
 #include "Logging.h"
 #include "Manager.h"
 #include "Message/MessageBus.h"
+#include "Message/MessageBusStats.h"
+#include "Profiler.h"
+#include "Random.h"
+#include "RenderBackend.h"
+#include "RenderStats.h"
 #include "RenderWindow.h"
 #include "Resource/TextureManager.h"
 #include "Screen.h"
@@ -24,25 +44,168 @@
 
 namespace FA {
 
+namespace {
+
+void LogRenderStats(const Graphic::RenderStats& maxStats)
+{
+    auto nFrames = Graphic::GetRenderedFrameCount();
+    if (nFrames == 0 || !Graphic::IsRenderStatsEnabled()) return;
+
+    auto total = Graphic::GetTotalRenderStats();
+    LOG_INFO("Rendered %u frames", nFrames);
+    LOG_INFO("Draw calls per frame avg: %u max: %u", total.nDrawCalls_ / nFrames, maxStats.nDrawCalls_);
+    LOG_INFO("Texture switches per frame avg: %u max: %u", total.nTextureSwitches_ / nFrames,
+             maxStats.nTextureSwitches_);
+    LOG_INFO("Vertices per frame avg: %zu max: %zu", total.nVertices_ / nFrames, maxStats.nVertices_);
+}
+
+// Collects the time of a game loop phase for the frame time metrics
+class PhaseTimer
+{
+public:
+    PhaseTimer(Util::FrameTimings* timings, const char* phase)
+        : timings_(timings)
+        , phase_(phase)
+        , start_(std::chrono::steady_clock::now())
+    {}
+
+    ~PhaseTimer()
+    {
+        if (timings_ == nullptr) return;
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start_;
+        timings_->Add(phase_, elapsed.count());
+    }
+
+private:
+    Util::FrameTimings* timings_ = nullptr;
+    const char* phase_ = nullptr;
+    std::chrono::steady_clock::time_point start_;
+};
+
+void LoadInputRecording(const std::string& path, Util::InputRecording& recording)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("Could not open " + path);
+    }
+    if (!Util::ReadInputRecording(file, recording)) {
+        throw std::runtime_error("Invalid input recording " + path);
+    }
+}
+
+void SaveInputRecording(const std::string& path, const Util::InputRecording& recording)
+{
+    std::ofstream file(path, std::ios::binary);
+    if (!file || !Util::WriteInputRecording(file, recording)) {
+        LOG_ERROR("Could not write %s", path.c_str());
+        return;
+    }
+    LOG_INFO("Saved %u frames of input to %s", static_cast<unsigned int>(recording.frames_.size()), path.c_str());
+}
+
+}  // namespace
+
+Game::Game(const GameOptions& options)
+    : options_(options)
+{}
+
 int Game::Run()
 {
+    if (options_.hasLogLevel_) {
+        Shared::SetLogLevel(options_.logLevel_);
+    }
+    for (auto channel : options_.mutedLogChannels_) {
+        Shared::SetLogChannelEnabled(channel, false);
+    }
+
     LOG_INFO_ENTER_FUNC();
     LOG_INFO("%s version %s", FA_APP_NAME, FA_APP_VERSION);
     LOG_INFO("SFML version %u.%u.%u", SFML_VERSION_MAJOR, SFML_VERSION_MINOR, SFML_VERSION_PATCH);
 
+    if (options_.profile_) {
+        LOG_INFO("Profiler enabled");
+        Util::Profiler::Instance().SetThreadName("Main");
+        Util::Profiler::Instance().Enable(true);
+    }
+
+    if (options_.headless_) {
+        LOG_INFO("Headless, using null render backend");
+        Graphic::SetRenderBackend(Graphic::RenderBackend::Null);
+    }
+
+    if (options_.renderStats_ || options_.headless_) {
+        LOG_INFO("Render stats enabled");
+        Graphic::EnableRenderStats(true);
+    }
+
+    if (options_.trackAllocations_) {
+        LOG_INFO("Allocation tracking enabled");
+        Util::EnableAllocationTracking(true);
+    }
+
+    if (options_.entityCosts_) {
+        LOG_INFO("Entity cost attribution enabled");
+        Entity::CostAttribution::Instance().Enable(true, options_.nTopEntities_);
+    }
+
+    unsigned int nWorkers = options_.hasWorkers_ ? options_.nWorkers_ : Util::JobSystem::DefaultWorkerCount();
+    LOG_INFO("Start %u worker threads", nWorkers);
+    Util::JobSystem::Instance().Start(nWorkers);
+    if (options_.hasEntityChunkSize_) {
+        Entity::SetEntityUpdateChunkSize(options_.entityChunkSize_);
+    }
+    LOG_INFO("Entity update chunk size %u", static_cast<unsigned int>(Entity::GetEntityUpdateChunkSize()));
+    if (options_.pipelined_) {
+        LOG_INFO("Pipelined level update enabled");
+        World::EnablePipelinedUpdate(true);
+    }
+    if (options_.offscreenLayers_) {
+        LOG_INFO("Scene layers are drawn through offscreen textures");
+        Scene::EnableDirectComposition(false);
+    }
+
+    Util::FrameTimings timings;
+    bool collectTimings = !options_.metricsPath_.empty() || !options_.baselinePath_.empty();
+    bool withinBudget = true;
     try {
-        GameLoop();
+        withinBudget = GameLoop(collectTimings ? &timings : nullptr);
     }
     catch (const std::exception& e) {
         LOG_ERROR("Exception catched: %s", e.what());
         return EXIT_FAILURE;
     }
 
+    Util::JobSystem::Instance().Stop();
+
+    if (options_.profile_) {
+        Util::Profiler::Instance().Enable(false);
+        Util::Profiler::Instance().ExportChromeTrace(Util::GetLogPath() + "/trace.json");
+    }
+
+    Util::EnableAllocationTracking(false);
+
+    if (options_.entityCosts_) {
+        auto& costAttribution = Entity::CostAttribution::Instance();
+        costAttribution.Enable(false);
+        auto path = Util::GetLogPath() + "/entity_costs.csv";
+        std::ofstream file(path);
+        costAttribution.WriteCsv(file);
+        LOG_INFO("Entity costs written to %s", path.c_str());
+    }
+
+    if (collectTimings && !CheckFrameMetrics(timings)) {
+        return EXIT_FAILURE;
+    }
+
+    if (!withinBudget) {
+        return EXIT_FAILURE;
+    }
+
     LOG_INFO_EXIT_FUNC();
     return EXIT_SUCCESS;
 }
 
-void Game::GameLoop()
+bool Game::GameLoop(Util::FrameTimings* timings)
 {
     LOG_INFO("Create main window");
     Graphic::RenderWindow window;
@@ -55,7 +218,18 @@ void Game::GameLoop()
     view.reset(sf::FloatRect(0.0, 0.0, Shared::Screen::width_f, Shared::Screen::height_f));
     window.setView(view);
 #endif
-    window.setFramerateLimit(120);
+    window.setFramerateLimit(options_.fpsLimit_);
+
+    // Seed before any scene is created, since they may use random numbers when entered
+    Util::InputRecording recording;
+    if (!options_.replayPath_.empty()) {
+        LoadInputRecording(options_.replayPath_, recording);
+    }
+    else {
+        recording.seed_ = options_.hasSeed_ ? options_.seed_ : static_cast<unsigned int>(std::time(nullptr));
+    }
+    LOG_INFO("Random seed %u", recording.seed_);
+    Util::SetRandomSeed(recording.seed_);
 
     Shared::MessageBus messageBus;
     auto createFn = []() { return std::make_unique<Graphic::Texture>(); };
@@ -65,19 +239,167 @@ void Game::GameLoop()
     sf::Clock clock;
     InputSystem inputSystem(messageBus, window);
 
+    if (!options_.replayPath_.empty()) {
+        LOG_INFO("Replay %u frames from %s", static_cast<unsigned int>(recording.frames_.size()),
+                 options_.replayPath_.c_str());
+        inputSystem.StartReplay(recording);
+    }
+    else if (!options_.recordPath_.empty()) {
+        inputSystem.StartRecording(recording);
+    }
+
     sfmlLog.Init();
     LOG_INFO("Start main loop");
+    Graphic::ResetRenderStats();
+    Graphic::RenderStats maxStats;
+    unsigned int nFrames = 0;
+    unsigned int nFramesOverBudget = 0;
+    Util::AllocationStats maxAllocations;
+    const float tickTime = options_.tickRate_ > 0 ? 1.0f / static_cast<float>(options_.tickRate_) : 0.0f;
+    float accumulator = 0.0f;
+    unsigned int nLaggingFrames = 0;
     while (sceneManager.IsRunning()) {
+        PROFILE_ZONE("Frame");
+        PhaseTimer frameTimer(timings, "Frame");
         sf::Time elapsed = clock.restart();
-        float deltaTime = elapsed.asSeconds();
-        inputSystem.Update(deltaTime);
-        sceneManager.Update(deltaTime);
-        window.clear();
-        sceneManager.DrawTo(window);
-        window.display();
+        float deltaTime = inputSystem.FrameDeltaTime(elapsed.asSeconds());
+        {
+            PhaseTimer timer(timings, "Input");
+            inputSystem.Update(deltaTime);
+        }
+        {
+            PROFILE_ZONE("Update");
+            PhaseTimer timer(timings, "Update");
+            if (tickTime > 0.0f) {
+                accumulator += deltaTime;
+                unsigned int nSteps = 0;
+                while (accumulator >= tickTime && nSteps < options_.maxSteps_) {
+                    sceneManager.Update(tickTime);
+                    accumulator -= tickTime;
+                    nSteps++;
+                }
+                // Too far behind, drop the time that can't be simulated instead of spiraling
+                if (accumulator >= tickTime) {
+                    accumulator = std::fmod(accumulator, tickTime);
+                    nLaggingFrames++;
+                }
+                sceneManager.Interpolate(accumulator / tickTime);
+            }
+            else {
+                sceneManager.Update(deltaTime);
+                sceneManager.Interpolate(1.0f);
+            }
+        }
+        {
+            PROFILE_ZONE("Draw");
+            PhaseTimer timer(timings, "Draw");
+            window.clear();
+            sceneManager.DrawTo(window);
+        }
+        {
+            PROFILE_ZONE("Display");
+            PhaseTimer timer(timings, "Display");
+            window.display();
+        }
+        {
+            PROFILE_ZONE("Sync");
+            PhaseTimer timer(timings, "Sync");
+            sceneManager.Sync();
+            messageBus.DispatchQueuedMessages();
+        }
+        nFrames++;
+        Util::EndAllocationFrame();
+        Entity::CostAttribution::Instance().EndFrame();
+        if (options_.hasAllocationBudget_ && nFrames > options_.nWarmupFrames_) {
+            auto allocations = Util::GetFrameAllocationStats();
+            maxAllocations.nAllocations_ = std::max(maxAllocations.nAllocations_, allocations.nAllocations_);
+            maxAllocations.nBytes_ = std::max(maxAllocations.nBytes_, allocations.nBytes_);
+            if (allocations.nAllocations_ > options_.allocationBudget_) {
+                nFramesOverBudget++;
+            }
+        }
+        auto frameStats = Graphic::GetFrameRenderStats();
+        maxStats.nDrawCalls_ = std::max(maxStats.nDrawCalls_, frameStats.nDrawCalls_);
+        maxStats.nTextureSwitches_ = std::max(maxStats.nTextureSwitches_, frameStats.nTextureSwitches_);
+        maxStats.nVertices_ = std::max(maxStats.nVertices_, frameStats.nVertices_);
+        if (options_.nFrames_ > 0 && Graphic::GetRenderedFrameCount() >= options_.nFrames_) {
+            LOG_INFO("Frame limit %u reached", options_.nFrames_);
+            break;
+        }
+        if (inputSystem.IsReplayDone()) {
+            LOG_INFO("Replay done");
+            break;
+        }
     }
 
     window.close();
+    if (nLaggingFrames > 0) {
+        LOG_WARN("Simulation fell behind in %u frames, max %u steps per frame", nLaggingFrames, options_.maxSteps_);
+    }
+    if (!options_.recordPath_.empty()) {
+        SaveInputRecording(options_.recordPath_, recording);
+    }
+    LogRenderStats(maxStats);
+
+    if (auto stats = messageBus.GetStats()) {
+        stats->Dump(Util::GetLogPath() + "/messagebus_stats.txt");
+    }
+
+    if (options_.hasAllocationBudget_) {
+        LOG_INFO("Max allocations per frame after warmup: %zu (%zu bytes)", maxAllocations.nAllocations_,
+                 maxAllocations.nBytes_);
+        if (nFramesOverBudget > 0) {
+            LOG_ERROR("%u frames exceeded allocation budget %u", nFramesOverBudget, options_.allocationBudget_);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool Game::CheckFrameMetrics(const Util::FrameTimings& timings) const
+{
+    if (timings.Count("Frame") == 0) {
+        LOG_ERROR("No frame timings collected");
+        return false;
+    }
+
+    auto metrics = timings.Compute();
+    for (const auto& entry : metrics) {
+        const auto& p = entry.second;
+        LOG_INFO("%s ms p50: %.3f p95: %.3f p99: %.3f max: %.3f", entry.first.c_str(), p.p50_, p.p95_, p.p99_,
+                 p.max_);
+    }
+
+    if (!options_.metricsPath_.empty()) {
+        std::ofstream file(options_.metricsPath_);
+        if (!file || !Util::WriteFrameMetrics(file, metrics)) {
+            LOG_ERROR("Could not write %s", options_.metricsPath_.c_str());
+        }
+    }
+
+    if (options_.baselinePath_.empty()) return true;
+
+    Util::FrameMetrics baseline;
+    std::ifstream file(options_.baselinePath_);
+    if (!file || !Util::ReadFrameMetrics(file, baseline)) {
+        LOG_ERROR("Could not read baseline %s", options_.baselinePath_.c_str());
+        return false;
+    }
+
+    for (const auto& phase : Util::MissingInBaseline(baseline, metrics)) {
+        LOG_WARN("%s is not in baseline %s and is not compared", phase.c_str(), options_.baselinePath_.c_str());
+    }
+    auto regressions = Util::CompareFrameMetrics(baseline, metrics, options_.tolerance_);
+    for (const auto& r : regressions) {
+        LOG_ERROR("Regression %s %s: %.3f ms, baseline %.3f ms", r.phase_.c_str(), r.metric_.c_str(), r.value_,
+                  r.baseline_);
+    }
+    if (regressions.empty()) {
+        LOG_INFO("No regression against %s with tolerance %.2f", options_.baselinePath_.c_str(), options_.tolerance_);
+    }
+
+    return regressions.empty();
 }
 
 }  // namespace FA
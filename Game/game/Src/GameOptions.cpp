@@ -0,0 +1,187 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "GameOptions.h"
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include "Logging.h"
+
+namespace FA {
+
+namespace {
+
+bool GetValue(const std::string& arg, const std::string& option, std::string& value)
+{
+    if (arg.compare(0, option.size(), option) != 0) return false;
+    value = arg.substr(option.size());
+
+    return true;
+}
+
+void ParseUnsigned(const std::string& arg, const std::string& value, unsigned int& result)
+{
+    try {
+        result = std::stoul(value);
+    }
+    catch (const std::logic_error&) {
+        LOG_WARN("Invalid option %s", arg.c_str());
+    }
+}
+
+void ParseLogLevel(const std::string& arg, const std::string& value, GameOptions& options)
+{
+    const std::pair<const char*, Util::LogLevel> levels[] = {{"debug", Util::LogLevel::Debug},
+                                                             {"info", Util::LogLevel::Info},
+                                                             {"warn", Util::LogLevel::Warn},
+                                                             {"error", Util::LogLevel::Error}};
+    for (const auto& level : levels) {
+        if (value == level.first) {
+            options.hasLogLevel_ = true;
+            options.logLevel_ = level.second;
+            return;
+        }
+    }
+    LOG_WARN("Invalid option %s", arg.c_str());
+}
+
+void ParseLogChannels(const std::string& arg, const std::string& value, std::vector<Shared::LogChannel>& channels)
+{
+    const std::pair<const char*, Shared::LogChannel> names[] = {{"general", Shared::LogChannel::General},
+                                                                {"entity", Shared::LogChannel::Entity},
+                                                                {"scene", Shared::LogChannel::Scene},
+                                                                {"world", Shared::LogChannel::World},
+                                                                {"resource", Shared::LogChannel::Resource}};
+    std::size_t start = 0;
+    while (start <= value.size()) {
+        auto end = std::min(value.find(',', start), value.size());
+        auto name = value.substr(start, end - start);
+        auto it = std::find_if(std::begin(names), std::end(names),
+                               [&name](const std::pair<const char*, Shared::LogChannel>& n) { return name == n.first; });
+        if (it != std::end(names)) {
+            channels.push_back(it->second);
+        }
+        else {
+            LOG_WARN("Invalid log channel %s in option %s", name.c_str(), arg.c_str());
+        }
+        start = end + 1;
+    }
+}
+
+}  // namespace
+
+GameOptions ParseGameOptions(int argc, char* argv[])
+{
+    GameOptions options;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        std::string value;
+        if (arg == "--profile") {
+            options.profile_ = true;
+        }
+        else if (arg == "--headless") {
+            options.headless_ = true;
+        }
+        else if (arg == "--render-stats") {
+            options.renderStats_ = true;
+        }
+        else if (GetValue(arg, "--frames=", value)) {
+            ParseUnsigned(arg, value, options.nFrames_);
+        }
+        else if (GetValue(arg, "--record=", value)) {
+            options.recordPath_ = value;
+        }
+        else if (GetValue(arg, "--replay=", value)) {
+            options.replayPath_ = value;
+        }
+        else if (GetValue(arg, "--seed=", value)) {
+            options.hasSeed_ = true;
+            ParseUnsigned(arg, value, options.seed_);
+        }
+        else if (GetValue(arg, "--metrics=", value)) {
+            options.metricsPath_ = value;
+        }
+        else if (GetValue(arg, "--baseline=", value)) {
+            options.baselinePath_ = value;
+        }
+        else if (arg == "--track-allocations") {
+            options.trackAllocations_ = true;
+        }
+        else if (GetValue(arg, "--alloc-budget=", value)) {
+            options.trackAllocations_ = true;
+            options.hasAllocationBudget_ = true;
+            ParseUnsigned(arg, value, options.allocationBudget_);
+        }
+        else if (arg == "--entity-costs") {
+            options.entityCosts_ = true;
+        }
+        else if (GetValue(arg, "--entity-costs=", value)) {
+            options.entityCosts_ = true;
+            ParseUnsigned(arg, value, options.nTopEntities_);
+        }
+        else if (GetValue(arg, "--warmup=", value)) {
+            ParseUnsigned(arg, value, options.nWarmupFrames_);
+        }
+        else if (GetValue(arg, "--tick-rate=", value)) {
+            ParseUnsigned(arg, value, options.tickRate_);
+        }
+        else if (GetValue(arg, "--max-steps=", value)) {
+            ParseUnsigned(arg, value, options.maxSteps_);
+        }
+        else if (GetValue(arg, "--fps-limit=", value)) {
+            ParseUnsigned(arg, value, options.fpsLimit_);
+        }
+        else if (GetValue(arg, "--workers=", value)) {
+            options.hasWorkers_ = true;
+            ParseUnsigned(arg, value, options.nWorkers_);
+        }
+        else if (GetValue(arg, "--entity-chunk=", value)) {
+            options.hasEntityChunkSize_ = true;
+            ParseUnsigned(arg, value, options.entityChunkSize_);
+        }
+        else if (arg == "--pipeline") {
+            options.pipelined_ = true;
+        }
+        else if (arg == "--offscreen-layers") {
+            options.offscreenLayers_ = true;
+        }
+        else if (GetValue(arg, "--log-level=", value)) {
+            ParseLogLevel(arg, value, options);
+        }
+        else if (GetValue(arg, "--log-mute=", value)) {
+            ParseLogChannels(arg, value, options.mutedLogChannels_);
+        }
+        else if (GetValue(arg, "--tolerance=", value)) {
+            try {
+                options.tolerance_ = std::stod(value);
+            }
+            catch (const std::logic_error&) {
+                LOG_WARN("Invalid option %s", arg.c_str());
+            }
+        }
+        else {
+            LOG_WARN("Unknown option %s", arg.c_str());
+        }
+    }
+
+    if (!options.recordPath_.empty() && !options.replayPath_.empty()) {
+        LOG_WARN("Can not both record and replay, ignore record");
+        options.recordPath_.clear();
+    }
+
+    if (options.maxSteps_ == 0) {
+        LOG_WARN("Max steps must be at least 1");
+        options.maxSteps_ = 1;
+    }
+
+    return options;
+}
+
+}  // namespace FA
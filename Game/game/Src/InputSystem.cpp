@@ -16,6 +16,7 @@
 #include "Message/BroadcastMessage/KeyPressedMessage.h"
 #include "Message/BroadcastMessage/KeyReleasedMessage.h"
 #include "Message/MessageBus.h"
+#include "Profiler.h"
 
 namespace FA {
 
@@ -24,40 +25,109 @@ InputSystem::InputSystem(Shared::MessageBus& messageBus, Graphic::RenderWindowIf
     , window_(window)
 {}
 
+void InputSystem::StartRecording(Util::InputRecording& recording)
+{
+    recording_ = &recording;
+    replay_ = nullptr;
+}
+
+void InputSystem::StartReplay(const Util::InputRecording& recording)
+{
+    replay_ = &recording;
+    replayFrame_ = 0;
+    recording_ = nullptr;
+}
+
+bool InputSystem::IsReplayDone() const
+{
+    return replay_ != nullptr && replayFrame_ >= replay_->frames_.size();
+}
+
+float InputSystem::FrameDeltaTime(float deltaTime) const
+{
+    if (replay_ != nullptr && !IsReplayDone()) {
+        return replay_->frames_[replayFrame_].deltaTime_;
+    }
+
+    return deltaTime;
+}
+
 void InputSystem::Update(float deltaTime)
 {
-    sf::Event event;
+    PROFILE_ZONE("InputSystem::Update");
+    std::vector<Util::InputRecording::Event> events;
+    PollEvents(events);
 
-    while (window_.pollEvent(event)) {
+    if (replay_ != nullptr) {
+        // Window is still polled to keep it responsive, but only close is used from it
+        bool close = std::any_of(events.begin(), events.end(), [](const Util::InputRecording::Event& e) {
+            return e.type_ == Util::InputRecording::EventType::Closed;
+        });
+        events.clear();
+        if (close) {
+            events.push_back({Util::InputRecording::EventType::Closed, 0});
+        }
+        if (!IsReplayDone()) {
+            const auto& replayEvents = replay_->frames_[replayFrame_++].events_;
+            events.insert(events.end(), replayEvents.begin(), replayEvents.end());
+        }
+    }
+    else if (recording_ != nullptr) {
+        recording_->frames_.push_back({deltaTime, events});
+    }
+
+    for (const auto& event : events) {
         ProcessEvent(event);
     }
 
     ProcessIsKeyPressed();
 }
 
-void InputSystem::ProcessEvent(const sf::Event& event)
+void InputSystem::PollEvents(std::vector<Util::InputRecording::Event>& events)
+{
+    sf::Event event;
+
+    while (window_.pollEvent(event)) {
+        switch (event.type) {
+            case sf::Event::KeyPressed:
+                events.push_back({Util::InputRecording::EventType::KeyPressed, event.key.code});
+                break;
+            case sf::Event::KeyReleased:
+                events.push_back({Util::InputRecording::EventType::KeyReleased, event.key.code});
+                break;
+            case sf::Event::Closed:
+                events.push_back({Util::InputRecording::EventType::Closed, 0});
+                break;
+            case sf::Event::LostFocus:
+                events.push_back({Util::InputRecording::EventType::LostFocus, 0});
+                break;
+        }
+    }
+}
+
+void InputSystem::ProcessEvent(const Util::InputRecording::Event& event)
 {
-    switch (event.type) {
-        case sf::Event::KeyPressed: {
-            auto key = event.key.code;
+    switch (event.type_) {
+        case Util::InputRecording::EventType::KeyPressed: {
+            auto key = static_cast<sf::Keyboard::Key>(event.key_);
             auto msg = std::make_shared<Shared::KeyPressedMessage>(key);
             pressedKeys_.emplace(key);
             messageBus_.SendMessage(msg);
             break;
         }
-        case sf::Event::KeyReleased: {
-            auto key = event.key.code;
+        case Util::InputRecording::EventType::KeyReleased: {
+            auto key = static_cast<sf::Keyboard::Key>(event.key_);
             auto msg = std::make_shared<Shared::KeyReleasedMessage>(key);
             pressedKeys_.erase(key);
             messageBus_.SendMessage(msg);
             break;
         }
-        case sf::Event::Closed: {
+        case Util::InputRecording::EventType::Closed: {
             auto msg = std::make_shared<Shared::CloseWindowMessage>();
             messageBus_.SendMessage(msg);
             break;
         }
-        case sf::Event::LostFocus: {
+        case Util::InputRecording::EventType::LostFocus: {
             ReleaseKeys();
         }
     }
@@ -10,6 +10,7 @@
 
 #include <SFML/Window/Keyboard.hpp>
 
+#include "InputRecording.h"
 #include "RenderWindowIf.h"
 
 namespace FA {
@@ -25,15 +26,25 @@ class InputSystem
 public:
     InputSystem(Shared::MessageBus& messageBus, Graphic::RenderWindowIf& window);
 
+    // Recording is appended to each frame, replay uses input and deltaTime from recording instead of window
+    void StartRecording(Util::InputRecording& recording);
+    void StartReplay(const Util::InputRecording& recording);
+    bool IsReplayDone() const;
+
+    float FrameDeltaTime(float deltaTime) const;
     void Update(float deltaTime);
 
 private:
     Graphic::RenderWindowIf& window_;
     Shared::MessageBus& messageBus_;
     std::unordered_set<sf::Keyboard::Key> pressedKeys_;
+    Util::InputRecording* recording_ = nullptr;
+    const Util::InputRecording* replay_ = nullptr;
+    std::size_t replayFrame_{};
 
 private:
-    void ProcessEvent(const sf::Event& event);
+    void PollEvents(std::vector<Util::InputRecording::Event>& events);
+    void ProcessEvent(const Util::InputRecording::Event& event);
     void ProcessIsKeyPressed();
     void ReleaseKeys();
 };
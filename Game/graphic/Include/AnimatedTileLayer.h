@@ -0,0 +1,80 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include "SfmlFwd.h"
+
+namespace FA {
+
+namespace Graphic {
+
+class QuadRun;
+class RenderTargetIf;
+class TextureIf;
+
+// Tiles that loop the same frames share one clip, and one clock per clip is advanced by Update. Instances only have a
+// position. DrawTo writes the current frame of the instances in the visible area into vertex arrays, so tiles out of
+// view cost nothing.
+class AnimatedTileLayer
+{
+public:
+    struct Frame
+    {
+        const TextureIf* texture_ = nullptr;
+        sf::IntRect rect_;
+    };
+
+    AnimatedTileLayer(float chunkSize);
+    ~AnimatedTileLayer();
+
+    std::size_t AddClip(const std::vector<Frame>& frames, float frameTime);  // same frames give same clip
+    void AddInstance(std::size_t clip, const sf::Vector2f& position);
+    void Update(float deltaTime);
+    void DrawTo(RenderTargetIf& renderTarget, const sf::FloatRect& visibleArea);
+    std::size_t GetClipCount() const { return clips_.size(); }
+
+private:
+    struct ClipFrame
+    {
+        const sf::Texture* texture_ = nullptr;
+        sf::IntRect rect_;
+    };
+
+    struct Clip
+    {
+        std::vector<ClipFrame> frames_;
+        float frameTime_{};
+        float time_{};
+        std::size_t current_{};
+    };
+
+    struct Instance
+    {
+        std::size_t clip_{};
+        sf::Vector2f position_;
+    };
+
+private:
+    float chunkSize_{};
+    std::vector<Clip> clips_;
+    std::map<std::pair<int, int>, std::vector<Instance>> chunks_;  // by row and column of instance position
+    sf::Vector2f maxSize_;                                         // of any frame, instances can reach out of chunk
+    std::vector<std::unique_ptr<QuadRun>> runs_;                   // reused between draws
+};
+
+}  // namespace Graphic
+
+}  // namespace FA
@@ -0,0 +1,54 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <SFML/Graphics/Rect.hpp>
+
+namespace FA {
+
+namespace Graphic {
+
+class QuadRun;
+class RenderTargetIf;
+class SpriteIf;
+
+// Static sprites baked into vertex arrays, one set per square chunk of the layer. DrawTo only draws the chunks that
+// intersect the visible area, so the cost follows the screen size instead of the layer size. Chunks are drawn row by
+// row, and sprites within a chunk in the order they were added. The chunks are immutable once drawn, so a render
+// command buffer refers to them instead of copying, and sprites must not be added while its commands are executed.
+class ChunkedSpriteLayer
+{
+public:
+    ChunkedSpriteLayer(float chunkSize);
+    ~ChunkedSpriteLayer();
+
+    void Add(const SpriteIf& sprite);
+    void DrawTo(RenderTargetIf& renderTarget, const sf::FloatRect& visibleArea) const;
+    std::size_t GetChunkCount() const { return chunks_.size(); }
+
+private:
+    struct Chunk
+    {
+        sf::FloatRect bounds_;
+        std::vector<std::unique_ptr<QuadRun>> runs_;  // sprites with same texture
+    };
+
+private:
+    float chunkSize_{};
+    std::map<std::pair<int, int>, Chunk> chunks_;  // by row and column
+    float maxOverhang_{};                          // sprites can reach out of their chunk
+};
+
+}  // namespace Graphic
+
+}  // namespace FA
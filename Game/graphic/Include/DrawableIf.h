@@ -22,6 +22,8 @@ public:
 private:
     friend class RenderWindow;
     friend class RenderTexture;
+    friend class ChunkedSpriteLayer;
+    friend class RenderCommandBuffer;
 
 private:
     virtual operator const sf::Drawable&() const = 0;
@@ -0,0 +1,22 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+namespace FA {
+
+namespace Graphic {
+
+// With the Null backend no window, OpenGL context or GPU resource is created. Draw calls are only counted, when
+// enabled in RenderStats.h. The backend must be selected before any graphic object is created.
+enum class RenderBackend { Sfml, Null };
+
+void SetRenderBackend(RenderBackend backend);
+RenderBackend GetRenderBackend();
+
+}  // namespace Graphic
+
+}  // namespace FA
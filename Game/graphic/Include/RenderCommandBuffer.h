@@ -0,0 +1,49 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include "RenderTargetIf.h"
+
+namespace FA {
+
+namespace Graphic {
+
+struct RenderCommands;
+
+// Records what is drawn to it as commands. A sprite is recorded as its texture, texture rect, transform and color,
+// shapes, texts and quads are copied, except immutable quads that are referred to. The copies are kept when cleared and
+// assigned again, so recording doesn't allocate once the buffer has grown. Commands are executed in the order they were
+// recorded, which is the draw order, see DrawHandler for the order of entities. Execute draws the commands to a target,
+// sprites in a row with the same texture in one draw call. Apart from immutable quads the commands do not refer to what
+// was drawn, so they can be executed while the recorded objects are changed by another thread, or executed more than
+// once.
+class RenderCommandBuffer : public RenderTargetIf
+{
+public:
+    RenderCommandBuffer();
+    virtual ~RenderCommandBuffer();
+    RenderCommandBuffer(const RenderCommandBuffer&) = delete;
+    RenderCommandBuffer& operator=(const RenderCommandBuffer&) = delete;
+
+    virtual void draw(const DrawableIf& drawable) override;
+    void Execute(RenderTargetIf& target);
+    void Clear();
+    std::size_t GetCount() const;
+
+private:
+    std::unique_ptr<RenderCommands> commands_;
+
+private:
+    void Flush(RenderTargetIf& target);
+};
+
+}  // namespace Graphic
+
+}  // namespace FA
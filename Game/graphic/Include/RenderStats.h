@@ -0,0 +1,37 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <iosfwd>
+
+namespace FA {
+
+namespace Graphic {
+
+struct RenderStats
+{
+    unsigned int nDrawCalls_{};
+    unsigned int nTextureSwitches_{};  // draws using another texture than the previous draw to the same target
+    std::size_t nVertices_{};
+};
+
+bool operator==(const RenderStats& lhs, const RenderStats& rhs);
+std::ostream& operator<<(std::ostream& os, const RenderStats& p);
+
+// Counts draw calls to RenderWindow and RenderTexture for both backends. A frame ends with RenderWindow::display.
+// Counting is off by default, then a draw only checks the flag. Frames are always counted.
+void EnableRenderStats(bool enable);
+bool IsRenderStatsEnabled();
+RenderStats GetFrameRenderStats();  // last completed frame
+RenderStats GetTotalRenderStats();
+unsigned int GetRenderedFrameCount();
+void ResetRenderStats();
+
+}  // namespace Graphic
+
+}  // namespace FA
@@ -8,6 +8,8 @@
 
 #include <memory>
 
+#include <SFML/System/Vector2.hpp>
+
 #include "RenderTextureIf.h"
 #include "SfmlFwd.h"
 
@@ -34,6 +36,8 @@ public:
 private:
     std::unique_ptr<sf::RenderTexture> renderTexture_;
     std::shared_ptr<const Graphic::TextureIf> texture_;
+    bool isNull_ = false;
+    sf::Vector2u size_;  // only used by null backend
 };
 
 }  // namespace Graphic
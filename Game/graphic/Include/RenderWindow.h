@@ -31,9 +31,11 @@ public:
     virtual void clear() override;
     virtual void clear(const sf::Color &color) override;
     virtual void setView(const sf::View &view) override;
+    virtual void setView(const Graphic::ViewIf &view) override;
 
 private:
     std::unique_ptr<sf::RenderWindow> renderWindow_;
+    bool isNull_ = false;
 };
 
 }  // namespace Graphic
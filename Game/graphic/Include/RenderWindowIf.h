@@ -15,6 +15,8 @@ namespace FA {
 
 namespace Graphic {
 
+class ViewIf;
+
 class RenderWindowIf : public RenderTargetIf
 {
 public:
@@ -28,6 +30,7 @@ public:
     virtual void clear() = 0;
     virtual void clear(const sf::Color &color) = 0;
     virtual void setView(const sf::View &view) = 0;
+    virtual void setView(const Graphic::ViewIf &view) = 0;
 };
 
 }  // namespace Graphic
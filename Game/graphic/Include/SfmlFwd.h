@@ -28,6 +28,7 @@ class Event;
 class Sprite;
 class View;
 class Font;
+class Image;
 class Drawable;
 class Color;
 class VideoMode;
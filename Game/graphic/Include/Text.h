@@ -29,6 +29,7 @@ public:
 
 private:
     std::shared_ptr<sf::Text> text_;
+    bool isNull_ = false;
 
 private:
     virtual operator const sf::Drawable &() const override;
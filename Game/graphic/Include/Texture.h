@@ -8,6 +8,8 @@
 
 #include <memory>
 
+#include <SFML/System/Vector2.hpp>
+
 #include "SfmlFwd.h"
 #include "TextureIf.h"
 
@@ -30,13 +32,17 @@ public:
     virtual bool loadFromFile(const std::string &filename, const sf::IntRect &area) override;
     virtual bool loadFromMemory(const void *data, std::size_t size) override;
     virtual bool loadFromMemory(const void *data, std::size_t size, const sf::IntRect &area) override;
+    virtual bool loadFromImage(const sf::Image &image) override;
 
     virtual sf::Vector2u getSize() const override;
 
 private:
     std::shared_ptr<sf::Texture> internalTexture_;
     sf::Texture *texture_{nullptr};
+    bool isNull_ = false;
+    sf::Vector2u size_;  // only used by null backend
 
+    friend class AnimatedTileLayer;
     friend class Sprite;
 
 private:
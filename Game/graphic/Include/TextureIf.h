@@ -22,6 +22,7 @@ public:
     virtual bool loadFromFile(const std::string &filename, const sf::IntRect &area) = 0;
     virtual bool loadFromMemory(const void *data, std::size_t size) = 0;
     virtual bool loadFromMemory(const void *data, std::size_t size, const sf::IntRect &area) = 0;
+    virtual bool loadFromImage(const sf::Image &image) = 0;
 
     virtual sf::Vector2u getSize() const = 0;
 };
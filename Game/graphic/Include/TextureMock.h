@@ -26,6 +26,8 @@ public:
     MOCK_METHOD((bool), loadFromMemory, (const void*, std::size_t), (override));
     MOCK_METHOD((bool), loadFromMemory, (const void*, std::size_t, const sf::IntRect&), (override));
 
+    MOCK_METHOD((bool), loadFromImage, (const sf::Image&), (override));
+
     MOCK_METHOD((sf::Vector2u), getSize, (), (const override));
 };
 
@@ -28,6 +28,7 @@ private:
     std::shared_ptr<sf::View> view_;
 
     friend class RenderTexture;
+    friend class RenderWindow;
 
 private:
     operator const sf::View &() const { return *view_; };
@@ -0,0 +1,112 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "AnimatedTileLayer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+#include <SFML/Graphics/Texture.hpp>
+
+#include "QuadBatch.h"
+#include "RenderTargetIf.h"
+#include "Texture.h"
+
+namespace FA {
+
+namespace Graphic {
+
+AnimatedTileLayer::AnimatedTileLayer(float chunkSize)
+    : chunkSize_(chunkSize)
+{}
+
+AnimatedTileLayer::~AnimatedTileLayer() = default;
+
+std::size_t AnimatedTileLayer::AddClip(const std::vector<Frame>& frames, float frameTime)
+{
+    Clip clip;
+    clip.frameTime_ = frameTime;
+    for (const auto& frame : frames) {
+        auto texture = dynamic_cast<const Texture*>(frame.texture_);
+        const sf::Texture* sfTexture = texture != nullptr ? &static_cast<const sf::Texture&>(*texture) : nullptr;
+        clip.frames_.push_back({sfTexture, frame.rect_});
+        maxSize_.x = std::max(maxSize_.x, static_cast<float>(std::abs(frame.rect_.width)));
+        maxSize_.y = std::max(maxSize_.y, static_cast<float>(std::abs(frame.rect_.height)));
+    }
+
+    auto it = std::find_if(clips_.begin(), clips_.end(), [&clip](const Clip& other) {
+        return other.frameTime_ == clip.frameTime_ &&
+               std::equal(other.frames_.begin(), other.frames_.end(), clip.frames_.begin(), clip.frames_.end(),
+                          [](const ClipFrame& a, const ClipFrame& b) {
+                              return a.texture_ == b.texture_ && a.rect_ == b.rect_;
+                          });
+    });
+    if (it != clips_.end()) {
+        return static_cast<std::size_t>(it - clips_.begin());
+    }
+
+    clips_.push_back(clip);
+    return clips_.size() - 1;
+}
+
+void AnimatedTileLayer::AddInstance(std::size_t clip, const sf::Vector2f& position)
+{
+    if (clips_.at(clip).frames_.empty()) return;
+
+    int row = static_cast<int>(std::floor(position.y / chunkSize_));
+    int column = static_cast<int>(std::floor(position.x / chunkSize_));
+    chunks_[{row, column}].push_back({clip, position});
+}
+
+void AnimatedTileLayer::Update(float deltaTime)
+{
+    for (auto& clip : clips_) {
+        if (clip.frames_.size() < 2 || clip.frameTime_ <= 0.0f) continue;
+
+        float loopTime = clip.frameTime_ * clip.frames_.size();
+        clip.time_ = std::fmod(clip.time_ + deltaTime, loopTime);
+        clip.current_ = std::min(static_cast<std::size_t>(clip.time_ / clip.frameTime_), clip.frames_.size() - 1);
+    }
+}
+
+void AnimatedTileLayer::DrawTo(RenderTargetIf& renderTarget, const sf::FloatRect& visibleArea)
+{
+    int firstRow = static_cast<int>(std::floor((visibleArea.top - maxSize_.y) / chunkSize_));
+    int lastRow = static_cast<int>(std::floor((visibleArea.top + visibleArea.height) / chunkSize_));
+    int firstColumn = static_cast<int>(std::floor((visibleArea.left - maxSize_.x) / chunkSize_));
+    int lastColumn = static_cast<int>(std::floor((visibleArea.left + visibleArea.width) / chunkSize_));
+
+    std::size_t nRuns = 0;
+    for (int row = firstRow; row <= lastRow; row++) {
+        auto it = chunks_.lower_bound({row, firstColumn});
+        auto end = chunks_.upper_bound({row, lastColumn});
+        for (; it != end; ++it) {
+            for (const auto& instance : it->second) {
+                const auto& frame = clips_[instance.clip_].frames_[clips_[instance.clip_].current_];
+                sf::FloatRect bounds(instance.position_, {static_cast<float>(std::abs(frame.rect_.width)),
+                                                          static_cast<float>(std::abs(frame.rect_.height))});
+                if (!bounds.intersects(visibleArea)) continue;
+
+                if (nRuns == 0 || runs_[nRuns - 1]->quads_.GetTexture() != frame.texture_) {
+                    if (nRuns == runs_.size()) {
+                        runs_.push_back(std::make_unique<QuadRun>());
+                    }
+                    runs_[nRuns++]->quads_.Clear();
+                }
+                runs_[nRuns - 1]->quads_.Add(frame.texture_, frame.rect_, instance.position_);
+            }
+        }
+    }
+
+    for (std::size_t i = 0; i < nRuns; i++) {
+        renderTarget.draw(*runs_[i]);
+    }
+}
+
+}  // namespace Graphic
+
+}  // namespace FA
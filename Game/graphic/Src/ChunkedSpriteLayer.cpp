@@ -0,0 +1,83 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "ChunkedSpriteLayer.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <SFML/Graphics/Sprite.hpp>
+
+#include "QuadBatch.h"
+#include "RenderTargetIf.h"
+#include "SpriteIf.h"
+
+namespace FA {
+
+namespace Graphic {
+
+ChunkedSpriteLayer::ChunkedSpriteLayer(float chunkSize)
+    : chunkSize_(chunkSize)
+{}
+
+ChunkedSpriteLayer::~ChunkedSpriteLayer() = default;
+
+void ChunkedSpriteLayer::Add(const SpriteIf& sprite)
+{
+    const sf::Drawable& sfDrawable = sprite;
+    const auto& sfSprite = dynamic_cast<const sf::Sprite&>(sfDrawable);
+    auto bounds = sfSprite.getGlobalBounds();
+    int row = static_cast<int>(std::floor(bounds.top / chunkSize_));
+    int column = static_cast<int>(std::floor(bounds.left / chunkSize_));
+    auto& chunk = chunks_[{row, column}];
+
+    if (chunk.runs_.empty() || chunk.runs_.back()->quads_.GetTexture() != sfSprite.getTexture()) {
+        chunk.runs_.push_back(std::make_unique<QuadRun>());
+        chunk.runs_.back()->isImmutable_ = true;
+    }
+    chunk.runs_.back()->quads_.Add(sfSprite);
+
+    if (chunk.bounds_.width == 0.0f && chunk.bounds_.height == 0.0f) {
+        chunk.bounds_ = bounds;
+    }
+    else {
+        float right = std::max(chunk.bounds_.left + chunk.bounds_.width, bounds.left + bounds.width);
+        float bottom = std::max(chunk.bounds_.top + chunk.bounds_.height, bounds.top + bounds.height);
+        chunk.bounds_.left = std::min(chunk.bounds_.left, bounds.left);
+        chunk.bounds_.top = std::min(chunk.bounds_.top, bounds.top);
+        chunk.bounds_.width = right - chunk.bounds_.left;
+        chunk.bounds_.height = bottom - chunk.bounds_.top;
+    }
+
+    float overhangX = bounds.left + bounds.width - (column + 1) * chunkSize_;
+    float overhangY = bounds.top + bounds.height - (row + 1) * chunkSize_;
+    maxOverhang_ = std::max({maxOverhang_, overhangX, overhangY});
+}
+
+void ChunkedSpriteLayer::DrawTo(RenderTargetIf& renderTarget, const sf::FloatRect& visibleArea) const
+{
+    // Sprites are put in the chunk of their top left corner, so chunks up and left of the area can reach into it
+    int firstRow = static_cast<int>(std::floor((visibleArea.top - maxOverhang_) / chunkSize_));
+    int lastRow = static_cast<int>(std::floor((visibleArea.top + visibleArea.height) / chunkSize_));
+    int firstColumn = static_cast<int>(std::floor((visibleArea.left - maxOverhang_) / chunkSize_));
+    int lastColumn = static_cast<int>(std::floor((visibleArea.left + visibleArea.width) / chunkSize_));
+
+    for (int row = firstRow; row <= lastRow; row++) {
+        auto it = chunks_.lower_bound({row, firstColumn});
+        auto end = chunks_.upper_bound({row, lastColumn});
+        for (; it != end; ++it) {
+            const auto& chunk = it->second;
+            if (!chunk.bounds_.intersects(visibleArea)) continue;
+            for (const auto& run : chunk.runs_) {
+                renderTarget.draw(*run);
+            }
+        }
+    }
+}
+
+}  // namespace Graphic
+
+}  // namespace FA
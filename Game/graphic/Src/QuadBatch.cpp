@@ -0,0 +1,83 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "QuadBatch.h"
+
+#include <cstdlib>
+
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+
+namespace FA {
+
+namespace Graphic {
+
+QuadBatch::QuadBatch()
+    : vertices_(sf::Triangles)
+{}
+
+void QuadBatch::Add(const sf::Sprite& sprite)
+{
+    Add(sprite.getTexture(), sprite.getTextureRect(), sprite.getTransform(), sprite.getColor());
+}
+
+// Same corners and texture coordinates as sfml uses for a sprite, a flipped texture rect flips the texture
+void QuadBatch::Add(const sf::Texture* texture, const sf::IntRect& rect, const sf::Transform& transform,
+                    const sf::Color& color)
+{
+    texture_ = texture;
+    float width = static_cast<float>(std::abs(rect.width));
+    float height = static_cast<float>(std::abs(rect.height));
+    sf::Vector2f corners[4] = {transform.transformPoint(0.0f, 0.0f), transform.transformPoint(width, 0.0f),
+                               transform.transformPoint(0.0f, height), transform.transformPoint(width, height)};
+    AddQuad(corners, rect, color);
+}
+
+// As an untransformed sprite at position
+void QuadBatch::Add(const sf::Texture* texture, const sf::IntRect& rect, const sf::Vector2f& position)
+{
+    texture_ = texture;
+    float width = static_cast<float>(std::abs(rect.width));
+    float height = static_cast<float>(std::abs(rect.height));
+    sf::Vector2f corners[4] = {position, position + sf::Vector2f(width, 0.0f), position + sf::Vector2f(0.0f, height),
+                               position + sf::Vector2f(width, height)};
+    AddQuad(corners, rect, sf::Color::White);
+}
+
+void QuadBatch::AddQuad(const sf::Vector2f (&corners)[4], const sf::IntRect& rect, const sf::Color& color)
+{
+    float left = static_cast<float>(rect.left);
+    float right = left + static_cast<float>(rect.width);
+    float top = static_cast<float>(rect.top);
+    float bottom = top + static_cast<float>(rect.height);
+
+    sf::Vertex topLeft(corners[0], color, {left, top});
+    sf::Vertex topRight(corners[1], color, {right, top});
+    sf::Vertex bottomLeft(corners[2], color, {left, bottom});
+    sf::Vertex bottomRight(corners[3], color, {right, bottom});
+    vertices_.append(topLeft);
+    vertices_.append(topRight);
+    vertices_.append(bottomLeft);
+    vertices_.append(bottomLeft);
+    vertices_.append(topRight);
+    vertices_.append(bottomRight);
+}
+
+void QuadBatch::Clear()
+{
+    texture_ = nullptr;
+    vertices_.clear();
+}
+
+void QuadBatch::draw(sf::RenderTarget& target, sf::RenderStates states) const
+{
+    states.texture = texture_;
+    target.draw(vertices_, states);
+}
+
+}  // namespace Graphic
+
+}  // namespace FA
@@ -0,0 +1,61 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+
+#include "DrawableIf.h"
+
+namespace FA {
+
+namespace Graphic {
+
+// Sprites with the same texture as two triangles each
+class QuadBatch : public sf::Drawable
+{
+public:
+    QuadBatch();
+
+    void Add(const sf::Sprite& sprite);
+    void Add(const sf::Texture* texture, const sf::IntRect& rect, const sf::Transform& transform,
+             const sf::Color& color);
+    void Add(const sf::Texture* texture, const sf::IntRect& rect, const sf::Vector2f& position);
+    void Clear();
+    const sf::Texture* GetTexture() const { return texture_; }
+    std::size_t GetVertexCount() const { return vertices_.getVertexCount(); }
+
+private:
+    const sf::Texture* texture_ = nullptr;
+    sf::VertexArray vertices_;
+
+private:
+    virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+    void AddQuad(const sf::Vector2f (&corners)[4], const sf::IntRect& rect, const sf::Color& color);
+};
+
+// Quads of one texture that are drawn to a RenderTargetIf
+class QuadRun : public DrawableIf
+{
+public:
+    QuadBatch quads_;
+    // Not changed or deleted while commands recorded from it are executed, then RenderCommandBuffer refers to it
+    // instead of copying its vertices
+    bool isImmutable_ = false;
+
+private:
+    virtual operator const sf::Drawable&() const override { return quads_; }
+};
+
+}  // namespace Graphic
+
+}  // namespace FA
@@ -0,0 +1,31 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "RenderBackend.h"
+
+namespace FA {
+
+namespace Graphic {
+
+namespace {
+
+RenderBackend backend = RenderBackend::Sfml;
+
+}  // namespace
+
+void SetRenderBackend(RenderBackend b)
+{
+    backend = b;
+}
+
+RenderBackend GetRenderBackend()
+{
+    return backend;
+}
+
+}  // namespace Graphic
+
+}  // namespace FA
@@ -0,0 +1,119 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "RenderCommandBuffer.h"
+
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Text.hpp>
+
+#include "RenderCommands.h"
+
+namespace FA {
+
+namespace Graphic {
+
+RenderCommandBuffer::RenderCommandBuffer()
+    : commands_(std::make_unique<RenderCommands>())
+{}
+
+RenderCommandBuffer::~RenderCommandBuffer() = default;
+
+void RenderCommandBuffer::draw(const DrawableIf& drawable)
+{
+    const sf::Drawable& sfDrawable = drawable;
+    auto& commands = *commands_;
+    RenderCommand command;
+
+    auto run = dynamic_cast<const QuadRun*>(&drawable);
+    if (run != nullptr && run->isImmutable_) {
+        command.kind_ = RenderCommand::Kind::Quads;
+        command.immutableQuads_ = run;
+    }
+    else if (auto sprite = dynamic_cast<const sf::Sprite*>(&sfDrawable)) {
+        command.texture_ = sprite->getTexture();
+        command.textureRect_ = sprite->getTextureRect();
+        command.transform_ = sprite->getTransform();
+        command.color_ = sprite->getColor();
+    }
+    else if (auto quads = dynamic_cast<const QuadBatch*>(&sfDrawable)) {
+        command.kind_ = RenderCommand::Kind::Quads;
+        command.index_ = commands.quads_.nUsed_;
+        commands.quads_.Next().quads_ = *quads;
+    }
+    else if (auto shape = dynamic_cast<const sf::RectangleShape*>(&sfDrawable)) {
+        command.kind_ = RenderCommand::Kind::Shape;
+        command.index_ = commands.shapes_.nUsed_;
+        commands.shapes_.Next().drawable_ = *shape;
+    }
+    else if (auto text = dynamic_cast<const sf::Text*>(&sfDrawable)) {
+        command.kind_ = RenderCommand::Kind::Text;
+        command.index_ = commands.texts_.nUsed_;
+        commands.texts_.Next().drawable_ = *text;
+    }
+    else {
+        return;  // no other drawables are wrapped by the graphic module
+    }
+
+    commands.commands_.push_back(command);
+}
+
+void RenderCommandBuffer::Execute(RenderTargetIf& target)
+{
+    auto& commands = *commands_;
+    commands.run_.quads_.Clear();
+
+    for (const auto& command : commands.commands_) {
+        if (command.kind_ == RenderCommand::Kind::Sprite) {
+            auto& run = commands.run_.quads_;
+            if (run.GetVertexCount() > 0 && run.GetTexture() != command.texture_) {
+                Flush(target);
+            }
+            run.Add(command.texture_, command.textureRect_, command.transform_, command.color_);
+            continue;
+        }
+
+        Flush(target);
+        if (command.kind_ == RenderCommand::Kind::Quads) {
+            target.draw(command.immutableQuads_ != nullptr ? *command.immutableQuads_
+                                                           : commands.quads_.copies_[command.index_]);
+        }
+        else if (command.kind_ == RenderCommand::Kind::Shape) {
+            target.draw(commands.shapes_.copies_[command.index_]);
+        }
+        else {
+            target.draw(commands.texts_.copies_[command.index_]);
+        }
+    }
+
+    Flush(target);
+}
+
+void RenderCommandBuffer::Clear()
+{
+    commands_->commands_.clear();
+    commands_->quads_.nUsed_ = 0;
+    commands_->shapes_.nUsed_ = 0;
+    commands_->texts_.nUsed_ = 0;
+}
+
+std::size_t RenderCommandBuffer::GetCount() const
+{
+    return commands_->commands_.size();
+}
+
+void RenderCommandBuffer::Flush(RenderTargetIf& target)
+{
+    auto& run = commands_->run_;
+    if (run.quads_.GetVertexCount() == 0) return;
+
+    target.draw(run);
+    run.quads_.Clear();
+}
+
+}  // namespace Graphic
+
+}  // namespace FA
@@ -0,0 +1,78 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/Text.hpp>
+#include <SFML/Graphics/Transform.hpp>
+
+#include "DrawableIf.h"
+#include "QuadBatch.h"
+
+namespace FA {
+
+namespace Graphic {
+
+struct RenderCommand
+{
+    enum class Kind { Sprite, Quads, Shape, Text };
+
+    Kind kind_ = Kind::Sprite;
+    std::size_t index_{};                      // in quads, shapes or texts when not a sprite
+    const QuadRun* immutableQuads_ = nullptr;  // drawn instead of a copy in quads
+    const sf::Texture* texture_ = nullptr;
+    sf::IntRect textureRect_;
+    sf::Transform transform_;
+    sf::Color color_;
+};
+
+// Copy of a shape or text, that can be drawn to a RenderTargetIf
+template <class T>
+class DrawableCopy : public DrawableIf
+{
+public:
+    T drawable_;
+
+private:
+    virtual operator const sf::Drawable&() const override { return drawable_; }
+};
+
+// Copies kept when cleared, so the next recording assigns to them and reuses their memory
+template <class T>
+struct CopyPool
+{
+    std::vector<T> copies_;
+    std::size_t nUsed_{};
+
+    T& Next()
+    {
+        if (nUsed_ == copies_.size()) {
+            copies_.emplace_back();
+        }
+        return copies_[nUsed_++];
+    }
+};
+
+// sfml side of RenderCommandBuffer
+struct RenderCommands
+{
+    std::vector<RenderCommand> commands_;
+    CopyPool<QuadRun> quads_;
+    CopyPool<DrawableCopy<sf::RectangleShape>> shapes_;
+    CopyPool<DrawableCopy<sf::Text>> texts_;
+    QuadRun run_;  // sprites in a row with the same texture while executing
+};
+
+}  // namespace Graphic
+
+}  // namespace FA
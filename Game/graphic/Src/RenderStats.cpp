@@ -0,0 +1,163 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "RenderStats.h"
+
+#include <atomic>
+#include <ostream>
+#include <tuple>
+#include <unordered_map>
+
+#include <SFML/Graphics/Shape.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Text.hpp>
+
+#include "QuadBatch.h"
+#include "RenderStatsCounter.h"
+
+namespace FA {
+
+namespace Graphic {
+
+namespace {
+
+struct Counters
+{
+    RenderStats current_;
+    RenderStats frame_;
+    RenderStats total_;
+    unsigned int nFrames_{};
+    std::unordered_map<const void*, const void*> lastTexture_;  // per render target
+};
+
+Counters& GetCounters()
+{
+    static Counters counters;
+    return counters;
+}
+
+std::atomic<bool>& GetEnabled()
+{
+    static std::atomic<bool> enabled{false};
+    return enabled;
+}
+
+// Vertex counts follow how sfml builds the geometry
+void Inspect(const sf::Drawable& drawable, const void*& texture, std::size_t& nVertices)
+{
+    if (auto sprite = dynamic_cast<const sf::Sprite*>(&drawable)) {
+        texture = sprite->getTexture();
+        nVertices = 4;
+    }
+    else if (auto shape = dynamic_cast<const sf::Shape*>(&drawable)) {
+        texture = shape->getTexture();
+        auto nPoints = shape->getPointCount();
+        nVertices = nPoints + 2;
+        if (shape->getOutlineThickness() != 0.0f) {
+            nVertices += (nPoints + 1) * 2;
+        }
+    }
+    else if (auto text = dynamic_cast<const sf::Text*>(&drawable)) {
+        texture = text->getFont();  // glyphs are on a font page texture
+        nVertices = text->getString().getSize() * 6;
+    }
+    else if (auto quads = dynamic_cast<const QuadBatch*>(&drawable)) {
+        texture = quads->GetTexture();
+        nVertices = quads->GetVertexCount();
+    }
+    else {
+        texture = nullptr;
+        nVertices = 0;
+    }
+}
+
+}  // namespace
+
+bool operator==(const RenderStats& lhs, const RenderStats& rhs)
+{
+    return std::tie(lhs.nDrawCalls_, lhs.nTextureSwitches_, lhs.nVertices_) ==
+           std::tie(rhs.nDrawCalls_, rhs.nTextureSwitches_, rhs.nVertices_);
+}
+
+std::ostream& operator<<(std::ostream& os, const RenderStats& p)
+{
+    os << "nDrawCalls: " << p.nDrawCalls_ << " nTextureSwitches: " << p.nTextureSwitches_
+       << " nVertices: " << p.nVertices_;
+
+    return os;
+}
+
+void EnableRenderStats(bool enable)
+{
+    GetEnabled().store(enable, std::memory_order_relaxed);
+}
+
+bool IsRenderStatsEnabled()
+{
+    return GetEnabled().load(std::memory_order_relaxed);
+}
+
+RenderStats GetFrameRenderStats()
+{
+    return GetCounters().frame_;
+}
+
+RenderStats GetTotalRenderStats()
+{
+    return GetCounters().total_;
+}
+
+unsigned int GetRenderedFrameCount()
+{
+    return GetCounters().nFrames_;
+}
+
+void ResetRenderStats()
+{
+    GetCounters() = Counters();
+}
+
+void CountDraw(const void* target, const sf::Drawable& drawable)
+{
+    const void* texture = nullptr;
+    std::size_t nVertices = 0;
+    Inspect(drawable, texture, nVertices);
+    CountDraw(target, texture, nVertices);
+}
+
+void CountDraw(const void* target, const void* texture, std::size_t nVertices)
+{
+    if (!IsRenderStatsEnabled()) return;
+
+    auto& counters = GetCounters();
+    counters.current_.nDrawCalls_++;
+    counters.current_.nVertices_ += nVertices;
+    auto it = counters.lastTexture_.find(target);
+    if (it == counters.lastTexture_.end()) {
+        counters.lastTexture_.emplace(target, texture);
+        counters.current_.nTextureSwitches_++;
+    }
+    else if (it->second != texture) {
+        it->second = texture;
+        counters.current_.nTextureSwitches_++;
+    }
+}
+
+void CountEndFrame()
+{
+    auto& counters = GetCounters();
+    counters.frame_ = counters.current_;
+    counters.total_.nDrawCalls_ += counters.current_.nDrawCalls_;
+    counters.total_.nTextureSwitches_ += counters.current_.nTextureSwitches_;
+    counters.total_.nVertices_ += counters.current_.nVertices_;
+    counters.nFrames_++;
+    counters.current_ = RenderStats();
+    counters.lastTexture_.clear();
+}
+
+}  // namespace Graphic
+
+}  // namespace FA
@@ -0,0 +1,23 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include "SfmlFwd.h"
+
+namespace FA {
+
+namespace Graphic {
+
+void CountDraw(const void* target, const sf::Drawable& drawable);
+void CountDraw(const void* target, const void* texture, std::size_t nVertices);
+void CountEndFrame();
+
+}  // namespace Graphic
+
+}  // namespace FA
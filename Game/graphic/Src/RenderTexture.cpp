@@ -10,6 +10,9 @@
 #include <SFML/Graphics/RenderTexture.hpp>
 
 #include "DrawableIf.h"
+#include "RenderBackend.h"
+#include "RenderStats.h"
+#include "RenderStatsCounter.h"
 #include "Texture.h"
 #include "View.h"
 
@@ -20,6 +23,7 @@ namespace Graphic {
 RenderTexture::RenderTexture()
     : renderTexture_(std::make_unique<sf::RenderTexture>())
     , texture_(Texture::CreateWrapper(renderTexture_->getTexture()))
+    , isNull_(GetRenderBackend() == RenderBackend::Null)
 {}
 
 RenderTexture::~RenderTexture() = default;
@@ -27,21 +31,31 @@ RenderTexture::~RenderTexture() = default;
 void RenderTexture::draw(const DrawableIf& drawable)
 {
     const sf::Drawable& sfDrawable = drawable;
-    return renderTexture_->draw(sfDrawable);
+    if (IsRenderStatsEnabled()) CountDraw(this, sfDrawable);
+    if (isNull_) return;
+    renderTexture_->draw(sfDrawable);
 }
 
 bool RenderTexture::create(unsigned int width, unsigned int height, bool depthBuffer)
 {
+    if (isNull_) {
+        size_ = {width, height};
+        return true;
+    }
+
     return renderTexture_->create(width, height, depthBuffer);
 }
 
 void RenderTexture::display()
 {
+    if (isNull_) return;
     renderTexture_->display();
 }
 
 sf::Vector2u RenderTexture::getSize() const
 {
+    if (isNull_) return size_;
+
     return renderTexture_->getSize();
 }
 
@@ -52,11 +66,13 @@ const Graphic::TextureIf& RenderTexture::getTexture() const
 
 void RenderTexture::clear()
 {
+    if (isNull_) return;
     renderTexture_->clear();
 }
 
 void RenderTexture::clear(const sf::Color& color)
 {
+    if (isNull_) return;
     renderTexture_->clear(color);
 }
 
@@ -8,7 +8,11 @@
 
 #include <SFML/Graphics/RenderWindow.hpp>
 
+#include "RenderBackend.h"
+#include "RenderStats.h"
+#include "RenderStatsCounter.h"
 #include "Sprite.h"
+#include "View.h"
 
 namespace FA {
 
@@ -16,6 +20,7 @@ namespace Graphic {
 
 RenderWindow::RenderWindow()
     : renderWindow_(std::make_unique<sf::RenderWindow>())
+    , isNull_(GetRenderBackend() == RenderBackend::Null)
 {}
 
 RenderWindow::~RenderWindow() = default;
@@ -23,46 +28,57 @@ RenderWindow::~RenderWindow() = default;
 void RenderWindow::draw(const DrawableIf& drawable)
 {
     const sf::Drawable& sfDrawable = drawable;
-    return renderWindow_->draw(sfDrawable);
+    if (IsRenderStatsEnabled()) CountDraw(this, sfDrawable);
+    if (isNull_) return;
+    renderWindow_->draw(sfDrawable);
 }
 
 void RenderWindow::display()
 {
+    CountEndFrame();
+    if (isNull_) return;
     renderWindow_->display();
 }
 
 bool RenderWindow::pollEvent(sf::Event& event)
 {
+    if (isNull_) return false;
     return renderWindow_->pollEvent(event);
 }
 
 void RenderWindow::create(sf::VideoMode mode, const std::string& title)
 {
+    if (isNull_) return;
     renderWindow_->create(mode, title);
 }
 
 void RenderWindow::create(sf::VideoMode mode, const std::string& title, sf::Uint32 style)
 {
+    if (isNull_) return;
     renderWindow_->create(mode, title, style);
 }
 
 void RenderWindow::close()
 {
+    if (isNull_) return;
     renderWindow_->close();
 }
 
 void RenderWindow::setFramerateLimit(unsigned int limit)
 {
+    if (isNull_) return;
     renderWindow_->setFramerateLimit(limit);
 }
 
 void RenderWindow::clear()
 {
+    if (isNull_) return;
     renderWindow_->clear(sf::Color(0, 0, 0, 255));
 }
 
 void RenderWindow::clear(const sf::Color& color)
 {
+    if (isNull_) return;
     renderWindow_->clear(color);
 }
 
@@ -71,6 +87,12 @@ void RenderWindow::setView(const sf::View& view)
     renderWindow_->setView(view);
 }
 
+void RenderWindow::setView(const Graphic::ViewIf& view)
+{
+    const sf::View& sfView = dynamic_cast<const View&>(view);
+    renderWindow_->setView(sfView);
+}
+
 }  // namespace Graphic
 
 }  // namespace FA
@@ -9,6 +9,7 @@
 #include <SFML/Graphics/Text.hpp>
 
 #include "Font.h"
+#include "RenderBackend.h"
 
 namespace FA {
 
@@ -16,6 +17,7 @@ namespace Graphic {
 
 Text::Text()
     : text_(std::make_shared<sf::Text>())
+    , isNull_(GetRenderBackend() == RenderBackend::Null)
 {}
 
 void Text::setString(const std::string &string)
@@ -41,6 +43,13 @@ void Text::setFillColor(const sf::Color &color)
 
 sf::FloatRect Text::getGlobalBounds() const
 {
+    // Glyph lookup renders to a font page texture, so the null backend only approximates the bounds
+    if (isNull_) {
+        auto size = static_cast<float>(text_->getCharacterSize());
+        auto width = static_cast<float>(text_->getString().getSize()) * size * 0.5f;
+        return text_->getTransform().transformRect({0.0f, 0.0f, width, size});
+    }
+
     return text_->getGlobalBounds();
 }
 
@@ -6,49 +6,104 @@
 
 #include "Texture.h"
 
+#include <SFML/Graphics/Image.hpp>
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/Texture.hpp>
 
+#include "RenderBackend.h"
+
 namespace FA {
 
 namespace Graphic {
 
+namespace {
+
+// Same clipping of area as sf::Texture::loadFromImage
+sf::Vector2u AreaSize(const sf::Vector2u& imageSize, const sf::IntRect& area)
+{
+    if (area.width == 0 || area.height == 0) return imageSize;
+
+    sf::IntRect rect = area;
+    if (rect.left < 0) rect.left = 0;
+    if (rect.top < 0) rect.top = 0;
+    if (rect.left + rect.width > static_cast<int>(imageSize.x)) rect.width = imageSize.x - rect.left;
+    if (rect.top + rect.height > static_cast<int>(imageSize.y)) rect.height = imageSize.y - rect.top;
+
+    return {static_cast<unsigned int>(rect.width), static_cast<unsigned int>(rect.height)};
+}
+
+}  // namespace
+
 Texture::Texture()
     : internalTexture_(std::make_shared<sf::Texture>())
     , texture_(internalTexture_.get())
+    , isNull_(GetRenderBackend() == RenderBackend::Null)
 {}
 
 Texture::Texture(const sf::Texture& texture)
     : texture_(const_cast<sf::Texture*>(&texture))
+    , isNull_(GetRenderBackend() == RenderBackend::Null)
 {}
 
 bool Texture::create(unsigned int width, unsigned int height)
 {
+    if (isNull_) {
+        size_ = {width, height};
+        return width > 0 && height > 0;
+    }
+
     return texture_->create(width, height);
 }
 
 bool Texture::loadFromFile(const std::string& filename)
 {
-    return texture_->loadFromFile(filename, sf::IntRect());
+    return loadFromFile(filename, sf::IntRect());
 }
 
 bool Texture::loadFromFile(const std::string& filename, const sf::IntRect& area)
 {
+    if (isNull_) {
+        // Decode the image on cpu only, to report the same errors and size as the sfml backend
+        sf::Image image;
+        if (!image.loadFromFile(filename)) return false;
+        size_ = AreaSize(image.getSize(), area);
+        return true;
+    }
+
     return texture_->loadFromFile(filename, area);
 }
 
 bool Texture::loadFromMemory(const void* data, std::size_t size)
 {
-    return texture_->loadFromMemory(data, size, sf::IntRect());
+    return loadFromMemory(data, size, sf::IntRect());
 }
 
 bool Texture::loadFromMemory(const void* data, std::size_t size, const sf::IntRect& area)
 {
+    if (isNull_) {
+        sf::Image image;
+        if (!image.loadFromMemory(data, size)) return false;
+        size_ = AreaSize(image.getSize(), area);
+        return true;
+    }
+
     return texture_->loadFromMemory(data, size, area);
 }
 
+bool Texture::loadFromImage(const sf::Image& image)
+{
+    if (isNull_) {
+        size_ = image.getSize();
+        return size_.x > 0 && size_.y > 0;
+    }
+
+    return texture_->loadFromImage(image);
+}
+
 sf::Vector2u Texture::getSize() const
 {
+    if (isNull_) return size_;
+
     return texture_->getSize();
 }
 
@@ -0,0 +1,133 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <SFML/Graphics/Sprite.hpp>
+
+#include "ChunkedSpriteLayer.h"
+#include "QuadBatch.h"
+#include "RenderBackend.h"
+#include "RenderTargetMock.h"
+#include "Sprite.h"
+#include "Texture.h"
+
+using namespace testing;
+
+namespace FA {
+
+namespace Graphic {
+
+class ChunkedSpriteLayerTest : public Test
+{
+protected:
+    using Run = std::pair<const sf::Texture*, std::size_t>;  // texture and number of sprites
+
+    ChunkedSpriteLayerTest()
+        : layer_(chunkSize_)
+    {}
+
+    virtual void SetUp() override
+    {
+        SetRenderBackend(RenderBackend::Null);
+        for (int i = 0; i < 3; i++) {
+            textures_.push_back(std::make_unique<Texture>());
+            textures_.back()->create(256, 256);
+        }
+    }
+
+    virtual void TearDown() override { SetRenderBackend(RenderBackend::Sfml); }
+
+    // The sprites are told apart by their count in the drawn runs
+    void AddSprites(float x, float y, int width, int height, int textureIndex, int n)
+    {
+        for (int i = 0; i < n; i++) {
+            sprites_.push_back(std::make_unique<Sprite>());
+            auto& sprite = *sprites_.back();
+            sprite.setTexture(*textures_[textureIndex]);
+            sprite.setTextureRect({0, 0, width, height});
+            sprite.setPosition(x, y);
+            layer_.Add(sprite);
+        }
+    }
+
+    std::vector<std::size_t> DrawnSpriteCounts(const sf::FloatRect& visibleArea)
+    {
+        std::vector<std::size_t> counts;
+        for (const auto& run : DrawTo(visibleArea)) {
+            counts.push_back(run.second);
+        }
+
+        return counts;
+    }
+
+    std::vector<Run> DrawTo(const sf::FloatRect& visibleArea)
+    {
+        std::vector<Run> runs;
+        EXPECT_CALL(renderTargetMock_, draw(_)).WillRepeatedly(Invoke([&runs](const DrawableIf& drawable) {
+            const auto& quads = dynamic_cast<const QuadRun&>(drawable).quads_;
+            runs.push_back({quads.GetTexture(), quads.GetVertexCount() / 6});
+        }));
+        layer_.DrawTo(renderTargetMock_, visibleArea);
+        Mock::VerifyAndClearExpectations(&renderTargetMock_);
+
+        return runs;
+    }
+
+    const float chunkSize_ = 100.0f;
+    std::vector<std::unique_ptr<Texture>> textures_;
+    std::vector<std::unique_ptr<Sprite>> sprites_;
+    StrictMock<RenderTargetMock> renderTargetMock_;
+    ChunkedSpriteLayer layer_;
+};
+
+TEST_F(ChunkedSpriteLayerTest, DrawToShouldOnlyDrawChunksThatIntersectVisibleArea)
+{
+    AddSprites(10.0f, 10.0f, 10, 10, 0, 1);
+    AddSprites(150.0f, 10.0f, 10, 10, 0, 2);
+    AddSprites(10.0f, 250.0f, 10, 10, 0, 3);
+
+    EXPECT_EQ(layer_.GetChunkCount(), 3u);
+    EXPECT_THAT(DrawnSpriteCounts({0.0f, 0.0f, 120.0f, 120.0f}), ElementsAre(1u));
+    EXPECT_THAT(DrawnSpriteCounts({100.0f, 0.0f, 100.0f, 100.0f}), ElementsAre(2u));
+    EXPECT_THAT(DrawnSpriteCounts({0.0f, 200.0f, 200.0f, 100.0f}), ElementsAre(3u));
+    EXPECT_THAT(DrawnSpriteCounts({300.0f, 300.0f, 100.0f, 100.0f}), IsEmpty());
+}
+
+TEST_F(ChunkedSpriteLayerTest, SpriteReachingIntoAreaFromChunkAboveOrLeftShouldBeDrawn)
+{
+    AddSprites(10.0f, 50.0f, 10, 120, 0, 1);   // chunk above the area, reaches down to 170
+    AddSprites(10.0f, 150.0f, 10, 10, 0, 2);   // in the area
+    AddSprites(50.0f, 310.0f, 120, 10, 0, 3);  // chunk left of the area, reaches right to 170
+
+    EXPECT_THAT(DrawnSpriteCounts({0.0f, 150.0f, 100.0f, 100.0f}), ElementsAre(1u, 2u));
+    EXPECT_THAT(DrawnSpriteCounts({150.0f, 300.0f, 100.0f, 100.0f}), ElementsAre(3u));
+}
+
+TEST_F(ChunkedSpriteLayerTest, RunsShouldBeSplitWhenTextureChanges)
+{
+    AddSprites(10.0f, 10.0f, 10, 10, 0, 2);
+    AddSprites(30.0f, 10.0f, 10, 10, 1, 1);
+    AddSprites(40.0f, 10.0f, 10, 10, 0, 1);
+
+    auto runs = DrawTo({0.0f, 0.0f, 100.0f, 100.0f});
+
+    ASSERT_EQ(runs.size(), 3u);
+    EXPECT_EQ(runs[0].second, 2u);
+    EXPECT_EQ(runs[1].second, 1u);
+    EXPECT_EQ(runs[2].second, 1u);
+    EXPECT_NE(runs[0].first, runs[1].first);
+    EXPECT_EQ(runs[2].first, runs[0].first);
+}
+
+}  // namespace Graphic
+
+}  // namespace FA
@@ -0,0 +1,168 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Text.hpp>
+
+#include "QuadBatch.h"
+#include "RectangleShape.h"
+#include "RenderBackend.h"
+#include "RenderCommandBuffer.h"
+#include "RenderCommands.h"
+#include "RenderTargetMock.h"
+#include "Sprite.h"
+#include "Text.h"
+#include "Texture.h"
+
+using namespace testing;
+
+namespace FA {
+
+namespace Graphic {
+
+class RenderCommandBufferTest : public Test
+{
+protected:
+    struct Drawn
+    {
+        std::string kind_;
+        const DrawableIf* drawable_ = nullptr;
+        const sf::Texture* texture_ = nullptr;
+        std::size_t nSprites_{};
+    };
+
+    virtual void SetUp() override
+    {
+        SetRenderBackend(RenderBackend::Null);
+        for (int i = 0; i < 2; i++) {
+            textures_.push_back(std::make_unique<Texture>());
+            textures_.back()->create(256, 256);
+        }
+    }
+
+    virtual void TearDown() override { SetRenderBackend(RenderBackend::Sfml); }
+
+    void DrawSprites(int textureIndex, int n)
+    {
+        for (int i = 0; i < n; i++) {
+            sprites_.push_back(std::make_unique<Sprite>());
+            auto& sprite = *sprites_.back();
+            sprite.setTexture(*textures_[textureIndex]);
+            sprite.setTextureRect({0, 0, 16, 16});
+            commands_.draw(sprite);
+        }
+    }
+
+    std::vector<Drawn> Execute()
+    {
+        std::vector<Drawn> drawn;
+        EXPECT_CALL(renderTargetMock_, draw(_)).WillRepeatedly(Invoke([&drawn](const DrawableIf& drawable) {
+            if (auto run = dynamic_cast<const QuadRun*>(&drawable)) {
+                const auto& quads = run->quads_;
+                drawn.push_back({"quads", &drawable, quads.GetTexture(), quads.GetVertexCount() / 6});
+            }
+            else if (dynamic_cast<const DrawableCopy<sf::RectangleShape>*>(&drawable) != nullptr) {
+                drawn.push_back({"shape", &drawable});
+            }
+            else if (dynamic_cast<const DrawableCopy<sf::Text>*>(&drawable) != nullptr) {
+                drawn.push_back({"text", &drawable});
+            }
+        }));
+        commands_.Execute(renderTargetMock_);
+        Mock::VerifyAndClearExpectations(&renderTargetMock_);
+
+        return drawn;
+    }
+
+    std::vector<std::unique_ptr<Texture>> textures_;
+    std::vector<std::unique_ptr<Sprite>> sprites_;
+    StrictMock<RenderTargetMock> renderTargetMock_;
+    RenderCommandBuffer commands_;
+};
+
+TEST_F(RenderCommandBufferTest, ExecuteShouldDrawCommandsInRecordedOrder)
+{
+    RectangleShape shape;
+    Text text;
+    DrawSprites(0, 1);
+    commands_.draw(text);
+    commands_.draw(shape);
+    DrawSprites(0, 1);
+
+    auto drawn = Execute();
+
+    EXPECT_EQ(commands_.GetCount(), 4u);
+    ASSERT_EQ(drawn.size(), 4u);
+    EXPECT_EQ(drawn[0].kind_, "quads");
+    EXPECT_EQ(drawn[1].kind_, "text");
+    EXPECT_EQ(drawn[2].kind_, "shape");
+    EXPECT_EQ(drawn[3].kind_, "quads");
+}
+
+TEST_F(RenderCommandBufferTest, ExecuteShouldDrawSpritesInARowWithSameTextureInOneDrawCall)
+{
+    DrawSprites(0, 3);
+    DrawSprites(1, 2);
+    DrawSprites(0, 1);
+
+    auto drawn = Execute();
+
+    ASSERT_EQ(drawn.size(), 3u);
+    EXPECT_EQ(drawn[0].nSprites_, 3u);
+    EXPECT_EQ(drawn[1].nSprites_, 2u);
+    EXPECT_EQ(drawn[2].nSprites_, 1u);
+    EXPECT_NE(drawn[0].texture_, drawn[1].texture_);
+    EXPECT_EQ(drawn[2].texture_, drawn[0].texture_);
+}
+
+TEST_F(RenderCommandBufferTest, ExecuteShouldDrawImmutableQuadsInPlaceAndOthersFromCopy)
+{
+    QuadRun immutableRun;
+    immutableRun.isImmutable_ = true;
+    QuadRun run;
+    run.quads_.Add(nullptr, {0, 0, 16, 16}, sf::Vector2f{});
+    commands_.draw(immutableRun);
+    commands_.draw(run);
+    run.quads_.Clear();
+
+    auto drawn = Execute();
+
+    ASSERT_EQ(drawn.size(), 2u);
+    EXPECT_EQ(drawn[0].drawable_, &immutableRun);
+    EXPECT_NE(drawn[1].drawable_, &run);
+    EXPECT_EQ(drawn[1].nSprites_, 1u);
+}
+
+TEST_F(RenderCommandBufferTest, ClearShouldReuseCopies)
+{
+    RectangleShape shape;
+    commands_.draw(shape);
+    auto first = Execute();
+
+    commands_.Clear();
+    EXPECT_EQ(commands_.GetCount(), 0u);
+    EXPECT_TRUE(Execute().empty());
+
+    commands_.draw(shape);
+    auto second = Execute();
+
+    ASSERT_EQ(first.size(), 1u);
+    ASSERT_EQ(second.size(), 1u);
+    EXPECT_EQ(second[0].kind_, "shape");
+    EXPECT_EQ(second[0].drawable_, first[0].drawable_);
+}
+
+}  // namespace Graphic
+
+}  // namespace FA
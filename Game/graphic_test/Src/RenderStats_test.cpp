@@ -0,0 +1,97 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <SFML/Graphics/Sprite.hpp>
+
+#include "RenderStats.h"
+#include "RenderStatsCounter.h"
+
+using namespace testing;
+
+namespace FA {
+
+namespace Graphic {
+
+class RenderStatsTest : public Test
+{
+protected:
+    void SetUp() override
+    {
+        ResetRenderStats();
+        EnableRenderStats(true);
+    }
+
+    void TearDown() override
+    {
+        EnableRenderStats(false);
+        ResetRenderStats();
+    }
+
+    const int target1_{};
+    const int target2_{};
+    const int texture1_{};
+    const int texture2_{};
+};
+
+TEST_F(RenderStatsTest, EndFrameShouldReturnCountsOfThatFrame)
+{
+    CountDraw(&target1_, &texture1_, 4);
+    CountDraw(&target1_, &texture1_, 6);
+    CountEndFrame();
+
+    EXPECT_EQ(GetFrameRenderStats(), (RenderStats{2, 1, 10}));
+    EXPECT_EQ(GetRenderedFrameCount(), 1u);
+}
+
+TEST_F(RenderStatsTest, TextureSwitchesShouldBeCountedPerTarget)
+{
+    CountDraw(&target1_, &texture1_, 4);
+    CountDraw(&target2_, &texture2_, 4);
+    CountDraw(&target1_, &texture1_, 4);
+    CountDraw(&target1_, &texture2_, 4);
+    CountEndFrame();
+
+    EXPECT_EQ(GetFrameRenderStats().nTextureSwitches_, 3u);
+}
+
+TEST_F(RenderStatsTest, TotalShouldSumAllFrames)
+{
+    CountDraw(&target1_, &texture1_, 4);
+    CountEndFrame();
+    CountDraw(&target1_, &texture1_, 4);
+    CountDraw(&target1_, &texture2_, 4);
+    CountEndFrame();
+
+    EXPECT_EQ(GetFrameRenderStats(), (RenderStats{2, 2, 8}));
+    EXPECT_EQ(GetTotalRenderStats(), (RenderStats{3, 3, 12}));
+    EXPECT_EQ(GetRenderedFrameCount(), 2u);
+}
+
+TEST_F(RenderStatsTest, SpriteShouldCountFourVertices)
+{
+    sf::Sprite sprite;
+    CountDraw(&target1_, sprite);
+    CountEndFrame();
+
+    EXPECT_EQ(GetFrameRenderStats(), (RenderStats{1, 1, 4}));
+}
+
+TEST_F(RenderStatsTest, DisabledStatsShouldOnlyCountFrames)
+{
+    EnableRenderStats(false);
+    CountDraw(&target1_, &texture1_, 4);
+    CountEndFrame();
+
+    EXPECT_EQ(GetFrameRenderStats(), RenderStats());
+    EXPECT_EQ(GetRenderedFrameCount(), 1u);
+}
+
+}  // namespace Graphic
+
+}  // namespace FA
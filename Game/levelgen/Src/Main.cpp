@@ -0,0 +1,110 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "TileMapData.h"
+#include "TileMapGenerator.h"
+#include "TileMapParser.h"
+#include "TmxWriter.h"
+
+namespace {
+
+void PrintUsage()
+{
+    std::cout << "Usage: levelgen [options]\n"
+              << "  --base=<tmx>      base map, tile sets and static layers are taken from it\n"
+              << "  --out=<tmx>       generated map, put it next to the base map so tile set sources resolve\n"
+              << "  --scale=<n>       n times the content of the base map (default 1)\n"
+              << "  --width=<tiles> --height=<tiles> --moles=<n> --coins=<n> --rects=<n>\n"
+              << "  --walls=<density> --animated=<n> --seed=<n>    override the scaled values\n";
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    std::string basePath = "../App/assets/map/levelCollider.tmx";
+    std::string outPath = "../App/assets/map/stress.tmx";
+    unsigned int scale = 1;
+    std::vector<std::string> overrides;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto pos = arg.find('=');
+        auto name = arg.substr(0, pos);
+        auto value = pos != std::string::npos ? arg.substr(pos + 1) : "";
+        if (name == "--base") {
+            basePath = value;
+        }
+        else if (name == "--out") {
+            outPath = value;
+        }
+        else if (name == "--scale") {
+            scale = std::stoul(value);
+        }
+        else if (name == "--help") {
+            PrintUsage();
+            return 0;
+        }
+        else {
+            overrides.push_back(arg);
+        }
+    }
+
+    FA::Tile::TileMapParser parser;
+    auto base = parser.Run(basePath);
+    auto params = FA::Tile::ScaledParams(base, scale);
+
+    for (const auto& arg : overrides) {
+        auto pos = arg.find('=');
+        auto name = arg.substr(0, pos);
+        auto value = pos != std::string::npos ? arg.substr(pos + 1) : "0";
+        if (name == "--width") {
+            params.width_ = std::stoul(value);
+        }
+        else if (name == "--height") {
+            params.height_ = std::stoul(value);
+        }
+        else if (name == "--moles") {
+            params.nMoles_ = std::stoul(value);
+        }
+        else if (name == "--coins") {
+            params.nCoins_ = std::stoul(value);
+        }
+        else if (name == "--rects") {
+            params.nRects_ = std::stoul(value);
+        }
+        else if (name == "--walls") {
+            params.wallDensity_ = std::stof(value);
+        }
+        else if (name == "--animated") {
+            params.nAnimatedTiles_ = std::stoul(value);
+        }
+        else if (name == "--seed") {
+            params.seed_ = std::stoul(value);
+        }
+        else {
+            std::cerr << "Unknown option " << arg << std::endl;
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    auto data = FA::Tile::GenerateTileMap(base, params);
+    std::ofstream file(outPath);
+    if (!file) {
+        std::cerr << "Could not open " << outPath << std::endl;
+        return 1;
+    }
+    FA::LevelGen::WriteTmx(file, data, FA::LevelGen::ReadTileSetSources(basePath));
+    std::cout << "Generated " << outPath << " {" << params << "}" << std::endl;
+
+    return 0;
+}
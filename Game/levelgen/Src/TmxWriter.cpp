@@ -0,0 +1,101 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "TmxWriter.h"
+
+#include <ostream>
+
+#include <tinyxml2/tinyxml2.h>
+
+#include "TileMapData.h"
+
+namespace FA {
+
+namespace LevelGen {
+
+std::vector<TileSetSource> ReadTileSetSources(const std::string& tmxFileName)
+{
+    std::vector<TileSetSource> sources;
+    tinyxml2::XMLDocument doc;
+    if (doc.LoadFile(tmxFileName.c_str()) != tinyxml2::XML_SUCCESS) return sources;
+
+    auto mapElement = doc.FirstChildElement("map");
+    if (mapElement == nullptr) return sources;
+
+    auto tileSetElement = mapElement->FirstChildElement("tileset");
+    while (tileSetElement != nullptr) {
+        const char* source = tileSetElement->Attribute("source");
+        if (source != nullptr) {
+            sources.push_back({tileSetElement->IntAttribute("firstgid"), source});
+        }
+        tileSetElement = tileSetElement->NextSiblingElement("tileset");
+    }
+
+    return sources;
+}
+
+void WriteTmx(std::ostream& os, const Tile::TileMapData& data, const std::vector<TileSetSource>& tileSetSources)
+{
+    const auto& p = data.mapProperties_;
+    int id = 1;
+
+    os << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+    os << "<map version=\"1.8\" orientation=\"orthogonal\" renderorder=\"right-down\" width=\"" << p.width_
+       << "\" height=\"" << p.height_ << "\" tilewidth=\"" << p.tileWidth_ << "\" tileheight=\"" << p.tileHeight_
+       << "\" infinite=\"0\">\n";
+
+    for (const auto& tileSet : tileSetSources) {
+        os << " <tileset firstgid=\"" << tileSet.firstGid_ << "\" source=\"" << tileSet.source_ << "\"/>\n";
+    }
+
+    for (const auto& layer : data.layers_) {
+        os << " <layer id=\"" << id++ << "\" name=\"" << layer.name_ << "\" width=\"" << p.width_ << "\" height=\""
+           << p.height_ << "\">\n";
+        os << "  <data encoding=\"csv\">\n";
+        for (std::size_t i = 0; i < layer.tileIds_.size(); i++) {
+            bool isLast = i + 1 == layer.tileIds_.size();
+            os << layer.tileIds_[i] << (isLast ? "" : ",");
+            if ((i + 1) % p.width_ == 0) os << "\n";
+        }
+        os << "</data>\n";
+        os << " </layer>\n";
+    }
+
+    for (const auto& group : data.objectGroups_) {
+        os << " <objectgroup id=\"" << id++ << "\" name=\"" << group.name_ << "\">\n";
+        for (const auto& object : group.objects_) {
+            bool isPoint = object.width_ == 0 && object.height_ == 0;
+            os << "  <object id=\"" << object.id_ << "\" type=\"" << object.typeStr_ << "\" x=\"" << object.x_
+               << "\" y=\"" << object.y_ << "\"";
+            if (!isPoint) {
+                os << " width=\"" << object.width_ << "\" height=\"" << object.height_ << "\"";
+            }
+            if (!isPoint && object.properties_.empty()) {
+                os << "/>\n";
+                continue;
+            }
+            os << ">\n";
+            if (!object.properties_.empty()) {
+                os << "   <properties>\n";
+                for (const auto& property : object.properties_) {
+                    os << "    <property name=\"" << property.first << "\" value=\"" << property.second << "\"/>\n";
+                }
+                os << "   </properties>\n";
+            }
+            if (isPoint) {
+                os << "   <point/>\n";
+            }
+            os << "  </object>\n";
+        }
+        os << " </objectgroup>\n";
+    }
+
+    os << "</map>\n";
+}
+
+}  // namespace LevelGen
+
+}  // namespace FA
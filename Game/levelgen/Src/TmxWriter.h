@@ -0,0 +1,35 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace FA {
+
+namespace Tile {
+
+struct TileMapData;
+
+}  // namespace Tile
+
+namespace LevelGen {
+
+struct TileSetSource
+{
+    int firstGid_{};
+    std::string source_;
+};
+
+// Tile sets are referenced by source since TileMapData only holds the parsed tsx content
+std::vector<TileSetSource> ReadTileSetSources(const std::string& tmxFileName);
+void WriteTmx(std::ostream& os, const Tile::TileMapData& data, const std::vector<TileSetSource>& tileSetSources);
+
+}  // namespace LevelGen
+
+}  // namespace FA
@@ -15,7 +15,7 @@ namespace FA {
 
 namespace Graphic {
 
-class RenderTargetIf;
+class RenderWindowIf;
 
 }  // namespace Graphic
 
@@ -33,6 +33,11 @@ class BasicTransition;
 class BasicLayer;
 enum class LayerId;
 
+// While enabled, scenes without a running transition draw the layers straight to the window. Otherwise each layer
+// is drawn to its own texture, which is then drawn to the window.
+void EnableDirectComposition(bool enable);
+bool IsDirectCompositionEnabled();
+
 class Manager
 {
 public:
@@ -41,6 +46,7 @@ public:
     struct Data
     {
         bool isRunning_ = true;
+        unsigned int stressScale_ = 1;  // content scale of generated level in StressScene
     };
 
     Manager(Shared::MessageBus& messageBus, Shared::TextureManager& textureManager);
@@ -59,8 +65,10 @@ public:
 
     void SetScene(std::unique_ptr<BasicScene> newScene);
 
-    void DrawTo(Graphic::RenderTargetIf& renderTarget);
+    void DrawTo(Graphic::RenderWindowIf& window);
     void Update(float deltaTime);
+    void Interpolate(float alpha);
+    void Sync();
 
     bool IsRunning() const;
 
@@ -10,6 +10,9 @@
 #include <SFML/Graphics/Rect.hpp>
 
 #include "Message/MessageBus.h"
+#include "Profiler.h"
+#include "RenderWindowIf.h"
+#include "Screen.h"
 
 namespace FA {
 
@@ -21,21 +24,73 @@ BasicLayer::BasicLayer(Shared::MessageBus& messageBus, const sf::IntRect& rect)
     layerTexture_.create(rect.width, rect.height);
     sprite_.setTexture(layerTexture_.getTexture());
     sprite_.setPosition(static_cast<float>(rect.left), static_cast<float>(rect.top));
+    screenView_.setSize({Shared::Screen::width_f, Shared::Screen::height_f});
+    screenView_.setCenter({Shared::Screen::centerX_f - rect.left, Shared::Screen::centerY_f - rect.top});
+    windowView_.setSize({Shared::Screen::width_f, Shared::Screen::height_f});
+    windowView_.setCenter({Shared::Screen::centerX_f, Shared::Screen::centerY_f});
 }
 
 BasicLayer::~BasicLayer() = default;
 
 void BasicLayer::Clear()
 {
+    PROFILE_ZONE("BasicLayer::Clear");
     layerTexture_.clear(sf::Color::Transparent);
+    isDisplayed_ = false;
+}
+
+void BasicLayer::Redraw()
+{
+    PrepareDraw();
+    if (cached_ && !dirty_) return;
+
+    Clear();
+    Draw();
+    dirty_ = false;
 }
 
 void BasicLayer::DrawTo(Graphic::RenderTargetIf& renderTarget)
 {
-    layerTexture_.display();
+    PROFILE_ZONE("BasicLayer::DrawTo");
+    if (!isDisplayed_) {
+        layerTexture_.display();
+        isDisplayed_ = true;
+    }
     renderTarget.draw(sprite_);
 }
 
+void BasicLayer::DrawDirectTo(Graphic::RenderWindowIf& window)
+{
+    PROFILE_ZONE("BasicLayer::DrawDirectTo");
+    if (cached_) {
+        Redraw();
+        window.setView(windowView_);
+        DrawTo(window);
+        return;
+    }
+
+    PrepareDraw();
+    window_ = &window;
+    window.setView(screenView_);
+    Draw();
+    window.setView(windowView_);
+    window_ = nullptr;
+}
+
+Graphic::RenderTargetIf& BasicLayer::GetTarget()
+{
+    if (window_ != nullptr) return *window_;
+    return layerTexture_;
+}
+
+void BasicLayer::SetView(const Graphic::View& view)
+{
+    layerTexture_.setView(view);
+    if (window_ != nullptr) {
+        window_->setView(view);
+    }
+}
+
 void BasicLayer::Subscribe(const std::vector<Shared::MessageType>& messageTypes)
 {
     messageBus_.AddSubscriber(Name(), messageTypes,
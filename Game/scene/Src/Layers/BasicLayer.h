@@ -14,12 +14,14 @@
 #include "RenderTexture.h"
 #include "SfmlFwd.h"
 #include "Sprite.h"
+#include "View.h"
 
 namespace FA {
 
 namespace Graphic {
 
 class RenderTargetIf;
+class RenderWindowIf;
 
 }  // namespace Graphic
 
@@ -44,6 +46,8 @@ public:
     virtual std::string Name() const = 0;
     virtual LayerId GetId() const = 0;
     virtual void Update(float deltaTime) = 0;
+    virtual void Interpolate(float alpha) {}
+    virtual void Sync() {}
     virtual void Draw() = 0;
     virtual void EnableInput(bool enable) = 0;
     virtual void EnterTransition(BasicTransition& transition) {}
@@ -55,20 +59,42 @@ public:
     virtual void UnsubscribeMessages() {}
 
     void Clear();
+    // Clears and draws the layer texture, unless the layer is cached and not dirty
+    void Redraw();
     void DrawTo(Graphic::RenderTargetIf& renderTarget);
+    // Draws the layer content straight to the window instead of through the layer texture, which saves a full
+    // screen blit. A cached layer is drawn from its texture, which is only redrawn when dirty. The window has the
+    // window view when it returns, as after drawing a cached layer.
+    void DrawDirectTo(Graphic::RenderWindowIf& window);
+    void MarkDirty() { dirty_ = true; }
 
 protected:
     Graphic::RenderTexture layerTexture_;
 
 protected:
+    // A cached layer keeps its texture from the last redraw until it is marked dirty
+    void EnableCache() { cached_ = true; }
+    // What Draw should draw to, the window when drawing directly, otherwise the layer texture
+    Graphic::RenderTargetIf& GetTarget();
+    // Sets the view on the layer texture and, when drawing directly, on the window. Transitions read the view of the
+    // layer texture, so it follows the content also when nothing is drawn to it.
+    void SetView(const Graphic::View& view);
     void Subscribe(const std::vector<Shared::MessageType>& messageTypes);
     void Unsubscribe(const std::vector<Shared::MessageType>& messageTypes);
 
 private:
     Graphic::Sprite sprite_;
+    Graphic::View screenView_;  // layer coordinates to window coordinates when drawing directly
+    Graphic::View windowView_;  // window coordinates, for drawing the layer texture
+    Graphic::RenderWindowIf* window_ = nullptr;
     Shared::MessageBus& messageBus_;
+    bool cached_ = false;
+    bool dirty_ = true;
+    bool isDisplayed_ = false;
 
 private:
+    // Called every frame before the layer is redrawn, a cached layer can mark itself dirty here
+    virtual void PrepareDraw() {}
     virtual void OnMessage(std::shared_ptr<Shared::Message> msg) {}
 };
 
@@ -4,14 +4,21 @@
  *	See file LICENSE for full license details.
  */
 
+#define FA_LOG_CHANNEL FA::Shared::LogChannel::Scene
+
 #include "HelperLayer.h"
 
 #include <cmath>
+#include <cstdio>
+#include <sstream>
 
 #include <SFML/Graphics/Color.hpp>
 #include <SFML/System/Vector2.hpp>
 
+#include "AllocationTracker.h"
+#include "CostAttribution.h"
 #include "Folder.h"
+#include "Format.h"
 #include "Logging.h"
 #include "Message/BroadcastMessage/EntityCreatedMessage.h"
 #include "Message/BroadcastMessage/EntityDestroyedMessage.h"
@@ -25,7 +32,9 @@ namespace Scene {
 HelperLayer::HelperLayer(Shared::MessageBus& messageBus, const sf::IntRect& rect, const std::string& sceneName)
     : BasicLayer(messageBus, rect)
     , sceneName_(sceneName)
-{}
+{
+    EnableCache();
+}
 
 HelperLayer::~HelperLayer() = default;
 
@@ -74,6 +83,20 @@ void HelperLayer::OnCreate()
     sf::Vector2f nEntitiesCountTextPos(180.0f, 50.0f);
     nEntitiesCountText_.setPosition(nEntitiesCountTextPos);
 
+    allocationsText_.setFont(font_);
+    allocationsText_.setString("");
+    allocationsText_.setCharacterSize(24);
+    allocationsText_.setFillColor(sf::Color::White);
+    sf::Vector2f allocationsTextPos(0.0f, 100.0f);
+    allocationsText_.setPosition(allocationsTextPos);
+
+    costText_.setFont(font_);
+    costText_.setString("");
+    costText_.setCharacterSize(18);
+    costText_.setFillColor(sf::Color::White);
+    sf::Vector2f costTextPos(0.0f, 150.0f);
+    costText_.setPosition(costTextPos);
+
     dotShape_.setSize(sf::Vector2f(1.0, 1.0));
     dotShape_.setPosition(layerTexture_.getSize().x / 2.0f, layerTexture_.getSize().y / 2.0f);
 }
@@ -88,21 +111,100 @@ void HelperLayer::UnsubscribeMessages()
     Unsubscribe({Shared::MessageType::EntityInitialized, Shared::MessageType::EntityDestroyed});
 }
 
+// Fps is measured here since Update runs at the simulation tick rate, which is not the render rate. It is averaged
+// over half a second, so the text and the layer are not rebuilt every frame.
+void HelperLayer::PrepareDraw()
+{
+    nFrames_++;
+    float elapsed = fpsClock_.getElapsedTime().asSeconds();
+    if (elapsed < 0.5f) return;
+
+    unsigned int fps = static_cast<unsigned int>(std::floor(nFrames_ / elapsed));
+    fpsClock_.restart();
+    nFrames_ = 0;
+    if (fps != shownFps_) {
+        shownFps_ = fps;
+        fpsNumberText_.setString(std::to_string(fps));
+        MarkDirty();
+    }
+}
+
 void HelperLayer::Draw()
 {
-    layerTexture_.draw(sceneText_);
-    layerTexture_.draw(fpsText_);
-    layerTexture_.draw(fpsNumberText_);
-    layerTexture_.draw(nEntitiesText_);
-    layerTexture_.draw(nEntitiesCountText_);
-    layerTexture_.draw(dotShape_);
+    auto& target = GetTarget();
+    target.draw(sceneText_);
+    target.draw(fpsText_);
+    target.draw(fpsNumberText_);
+    target.draw(nEntitiesText_);
+    target.draw(nEntitiesCountText_);
+    if (Util::IsAllocationTrackingEnabled()) {
+        target.draw(allocationsText_);
+    }
+    if (Entity::CostAttribution::Instance().IsEnabled()) {
+        target.draw(costText_);
+    }
+    target.draw(dotShape_);
 }
 
 void HelperLayer::Update(float deltaTime)
 {
-    unsigned int fps = static_cast<unsigned int>(std::floor(1.0f / deltaTime));
-    fpsNumberText_.setString(std::to_string(fps));
-    nEntitiesCountText_.setString(std::to_string(nEntities_));
+    if (nEntities_ != shownNEntities_) {
+        shownNEntities_ = nEntities_;
+        nEntitiesCountText_.setString(std::to_string(nEntities_));
+        MarkDirty();
+    }
+    if (Util::IsAllocationTrackingEnabled()) {
+        UpdateAllocationsText();
+    }
+    if (Entity::CostAttribution::Instance().IsEnabled()) {
+        UpdateCostText();
+    }
+}
+
+// Compared as numbers and formatted into a fixed buffer, so the tick that shows allocations does not allocate itself
+void HelperLayer::UpdateAllocationsText()
+{
+    auto allocations = Util::GetFrameAllocationStats();
+    if (allocations.nAllocations_ == shownAllocations_.nAllocations_ &&
+        allocations.nBytes_ == shownAllocations_.nBytes_) {
+        return;
+    }
+
+    shownAllocations_ = allocations;
+    char str[64];
+    std::snprintf(str, sizeof(str), "Allocations: %zu (%zu bytes)", allocations.nAllocations_, allocations.nBytes_);
+    allocationsText_.setString(str);
+    MarkDirty();
+}
+
+void HelperLayer::UpdateCostText()
+{
+    using Phase = Entity::CostAttribution::Phase;
+    const auto& costAttribution = Entity::CostAttribution::Instance();
+    std::stringstream ss;
+
+    ss << "ms: update / collision / draw\n";
+    for (const auto& entry : costAttribution.GetFrameCosts()) {
+        const auto& costs = entry.second;
+        auto update = costs[static_cast<std::size_t>(Phase::Update)].ms_;
+        auto collision = costs[static_cast<std::size_t>(Phase::Collision)].ms_;
+        auto draw = costs[static_cast<std::size_t>(Phase::Draw)].ms_;
+        ss << entry.first << Util::ToString(": %.3f / %.3f / %.3f\n", update, collision, draw);
+    }
+    for (const auto& entityCost : costAttribution.GetTopEntities()) {
+        ss << entityCost.type_ << " " << entityCost.id_ << Util::ToString(": %.3f\n", entityCost.ms_);
+    }
+    SetString(costText_, cost_, ss.str());
+}
+
+// Setting the string rebuilds the glyph geometry, so it is only done when the string changes
+void HelperLayer::SetString(Graphic::Text& text, std::string& shown, const std::string& str)
+{
+    if (str == shown) return;
+
+    shown = str;
+    text.setString(str);
+    MarkDirty();
 }
 
 void HelperLayer::OnMessage(std::shared_ptr<Shared::Message> msg)
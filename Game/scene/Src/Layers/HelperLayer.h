@@ -8,6 +8,9 @@
 
 #include <string>
 
+#include <SFML/System/Clock.hpp>
+
+#include "AllocationTracker.h"
 #include "Font.h"
 #include "RectangleShape.h"
 #include "Text.h"
@@ -42,10 +45,22 @@ private:
     Graphic::Text fpsNumberText_;
     Graphic::Text nEntitiesText_;
     Graphic::Text nEntitiesCountText_;
+    Graphic::Text allocationsText_;
+    Graphic::Text costText_;
     std::string sceneName_;
     unsigned int nEntities_ = 0;
+    unsigned int shownNEntities_ = 0;
+    sf::Clock fpsClock_;
+    unsigned int nFrames_ = 0;
+    unsigned int shownFps_ = 0;
+    Util::AllocationStats shownAllocations_;
+    std::string cost_;
 
 private:
+    virtual void PrepareDraw() override;
+    void SetString(Graphic::Text& text, std::string& shown, const std::string& str);
+    void UpdateAllocationsText();
+    void UpdateCostText();
     virtual void OnMessage(std::shared_ptr<Shared::Message> message) override;
 };
 
@@ -4,6 +4,8 @@
  *	See file LICENSE for full license details.
  */
 
+#define FA_LOG_CHANNEL FA::Shared::LogChannel::Scene
+
 #include "IntroLayer.h"
 
 #include <SFML/Graphics/RenderWindow.hpp>
@@ -18,7 +20,9 @@ namespace Scene {
 
 IntroLayer::IntroLayer(Shared::MessageBus& messageBus, const sf::IntRect& rect)
     : BasicLayer(messageBus, rect)
-{}
+{
+    EnableCache();
+}
 
 IntroLayer::~IntroLayer() = default;
 
@@ -53,8 +57,9 @@ void IntroLayer::OnCreate()
 
 void IntroLayer::Draw()
 {
-    layerTexture_.draw(introText_);
-    layerTexture_.draw(pressText_);
+    auto& target = GetTarget();
+    target.draw(introText_);
+    target.draw(pressText_);
 }
 
 void IntroLayer::Update(float deltaTime)
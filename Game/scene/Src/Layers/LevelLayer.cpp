@@ -41,8 +41,8 @@ void LevelLayer::OnCreate()
 void LevelLayer::Draw()
 {
     auto view = level_->GetView();
-    layerTexture_.setView(view);
-    level_->Draw(layerTexture_);  // When drawing, the view must already have been set
+    SetView(view);
+    level_->Draw(GetTarget());  // When drawing, the view must already have been set
 }
 
 void LevelLayer::DrawTransition(const BasicTransition& transition)
@@ -55,6 +55,16 @@ void LevelLayer::Update(float deltaTime)
     level_->Update(deltaTime);
 }
 
+void LevelLayer::Interpolate(float alpha)
+{
+    level_->Interpolate(alpha);
+}
+
+void LevelLayer::Sync()
+{
+    level_->Sync();
+}
+
 void LevelLayer::EnterTransition(BasicTransition& transition)
 {
     transition.Enter(layerTexture_);
@@ -37,6 +37,8 @@ public:
     virtual std::string Name() const override { return "Level"; }
     virtual LayerId GetId() const override { return LayerId::Level; }
     virtual void Update(float deltaTime) override;
+    virtual void Interpolate(float alpha) override;
+    virtual void Sync() override;
     virtual void Draw() override;
     virtual void EnableInput(bool enable) override {}
     virtual void EnterTransition(BasicTransition& transition) override;
@@ -4,6 +4,8 @@
  *	See file LICENSE for full license details.
  */
 
+#define FA_LOG_CHANNEL FA::Shared::LogChannel::Scene
+
 #include "PreAlphaLayer.h"
 
 #include <SFML/Graphics/RenderWindow.hpp>
@@ -19,7 +21,9 @@ namespace Scene {
 
 PreAlphaLayer::PreAlphaLayer(Shared::MessageBus& messageBus, const sf::IntRect& rect)
     : BasicLayer(messageBus, rect)
-{}
+{
+    EnableCache();
+}
 
 PreAlphaLayer::~PreAlphaLayer() = default;
 
@@ -46,7 +50,7 @@ void PreAlphaLayer::OnCreate()
 
 void PreAlphaLayer::Draw()
 {
-    layerTexture_.draw(versionText_);
+    GetTarget().draw(versionText_);
 }
 
 void PreAlphaLayer::Update(float deltaTime)
@@ -0,0 +1,85 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#define FA_LOG_CHANNEL FA::Shared::LogChannel::Scene
+
+#include "StressLayer.h"
+
+#include "Folder.h"
+#include "Level.h"
+#include "Logging.h"
+#include "TileMapData.h"
+#include "TileMapGenerator.h"
+#include "TileMapParser.h"
+#include "Transitions/BasicTransition.h"
+#include "View.h"
+
+namespace FA {
+
+namespace Scene {
+
+StressLayer::StressLayer(Shared::MessageBus& messageBus, const sf::IntRect& rect,
+                         Shared::TextureManager& textureManager, unsigned int scale)
+    : BasicLayer(messageBus, rect)
+    , messageBus_(messageBus)
+    , textureManager_(textureManager)
+    , scale_(scale)
+{
+    auto viewSize = layerTexture_.getSize();
+    level_ = std::make_unique<World::Level>(messageBus_, textureManager_, viewSize);
+}
+
+StressLayer::~StressLayer() = default;
+
+void StressLayer::OnLoad()
+{
+    Tile::TileMapParser parser;
+    auto base = parser.Run(Util::GetAssetsPath() + "/map/levelCollider.tmx");
+    auto params = Tile::ScaledParams(base, scale_);
+    LOG_INFO("Generate stress level %s", DUMP(params));
+    level_->Load(Tile::GenerateTileMap(base, params));
+}
+
+void StressLayer::OnCreate()
+{
+    level_->Create();
+}
+
+void StressLayer::Draw()
+{
+    auto view = level_->GetView();
+    SetView(view);
+    level_->Draw(GetTarget());
+}
+
+void StressLayer::DrawTransition(const BasicTransition& transition)
+{
+    transition.DrawTo(layerTexture_);
+}
+
+void StressLayer::Update(float deltaTime)
+{
+    level_->Update(deltaTime);
+}
+
+void StressLayer::Interpolate(float alpha)
+{
+    level_->Interpolate(alpha);
+}
+
+void StressLayer::Sync()
+{
+    level_->Sync();
+}
+
+void StressLayer::EnterTransition(BasicTransition& transition)
+{
+    transition.Enter(layerTexture_);
+}
+
+}  // namespace Scene
+
+}  // namespace FA
@@ -4,6 +4,8 @@
  *	See file LICENSE for full license details.
  */
 
+#define FA_LOG_CHANNEL FA::Shared::LogChannel::Scene
+
 #include "Manager.h"
 
 #include "Logging.h"
@@ -14,6 +16,22 @@ namespace FA {
 
 namespace Scene {
 
+namespace {
+
+bool directComposition = true;
+
+}  // namespace
+
+void EnableDirectComposition(bool enable)
+{
+    directComposition = enable;
+}
+
+bool IsDirectCompositionEnabled()
+{
+    return directComposition;
+}
+
 Manager::Manager(Shared::MessageBus& messageBus, Shared::TextureManager& textureManager)
 {
     currentScene_ = std::make_unique<IntroScene>(*this, messageBus, textureManager, layers_, data_);
@@ -43,9 +61,9 @@ void Manager::SetTransitionScene(Shared::MessageBus& messageBus, Shared::Texture
         std::make_unique<TransitionScene>(*this, messageBus, textureManager, layers_, data_, std::move(transition)));
 }
 
-void Manager::DrawTo(Graphic::RenderTargetIf& renderTarget)
+void Manager::DrawTo(Graphic::RenderWindowIf& window)
 {
-    currentScene_->DrawTo(renderTarget);
+    currentScene_->DrawTo(window);
 }
 
 void Manager::Update(float deltaTime)
@@ -53,6 +71,16 @@ void Manager::Update(float deltaTime)
     currentScene_->Update(deltaTime);
 }
 
+void Manager::Interpolate(float alpha)
+{
+    currentScene_->Interpolate(alpha);
+}
+
+void Manager::Sync()
+{
+    currentScene_->Sync();
+}
+
 bool Manager::IsRunning() const
 {
     return currentScene_->IsRunning();
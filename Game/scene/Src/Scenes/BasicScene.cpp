@@ -23,6 +23,22 @@ BasicScene::BasicScene(Manager &sceneManager, Shared::MessageBus &messageBus, Sh
 
 BasicScene::~BasicScene() = default;
 
+void BasicScene::Interpolate(float alpha)
+{
+    for (const auto &entry : layers_) {
+        auto &layer = entry.second;
+        layer->Interpolate(alpha);
+    }
+}
+
+void BasicScene::Sync()
+{
+    for (const auto &entry : layers_) {
+        auto &layer = entry.second;
+        layer->Sync();
+    }
+}
+
 // TODO: Consider to request for sceneSwitch here, and do actual switch after Update().
 // Then Update() can continue to execute code after the request is made.
 void BasicScene::SwitchScene(std::unique_ptr<BasicScene> newScene)
@@ -15,7 +15,7 @@ namespace FA {
 
 namespace Graphic {
 
-class RenderTargetIf;
+class RenderWindowIf;
 
 }  // namespace Graphic
 
@@ -35,8 +35,10 @@ public:
                Manager::Layers& layers, Manager::Data& data);
     virtual ~BasicScene();
 
-    virtual void DrawTo(Graphic::RenderTargetIf& renderTarget) = 0;
+    virtual void DrawTo(Graphic::RenderWindowIf& window) = 0;
     virtual void Update(float deltaTime) = 0;
+    virtual void Interpolate(float alpha);
+    virtual void Sync();
     virtual std::string Name() const = 0;
 
     virtual void Enter() {}
@@ -14,7 +14,9 @@
 #include "Message/BroadcastMessage/CloseWindowMessage.h"
 #include "Message/BroadcastMessage/KeyPressedMessage.h"
 #include "PlayScene.h"
+#include "RenderWindowIf.h"
 #include "Screen.h"
+#include "StressScene.h"
 
 namespace FA {
 
@@ -63,13 +65,16 @@ void IntroScene::Exit()
     }
 }
 
-void IntroScene::DrawTo(Graphic::RenderTargetIf& renderTarget)
+void IntroScene::DrawTo(Graphic::RenderWindowIf& window)
 {
     for (const auto& entry : layers_) {
         auto& layer = entry.second;
-        layer->Clear();
-        layer->Draw();
-        layer->DrawTo(renderTarget);
+        if (IsDirectCompositionEnabled()) {
+            layer->DrawDirectTo(window);
+            continue;
+        }
+        layer->Redraw();
+        layer->DrawTo(window);
     }
 }
 
@@ -96,6 +101,11 @@ void IntroScene::OnMessage(std::shared_ptr<Shared::Message> msg)
         else if (key == sf::Keyboard::Key::Return) {
             SwitchScene<PlayScene>();
         }
+#ifdef _DEBUG
+        else if (key == sf::Keyboard::Key::F1) {
+            SwitchScene<StressScene>();
+        }
+#endif
     }
 }
 
@@ -14,6 +14,7 @@
 #include "Layers/PreAlphaLayer.h"
 #include "Message/BroadcastMessage/CloseWindowMessage.h"
 #include "Message/BroadcastMessage/KeyPressedMessage.h"
+#include "RenderWindowIf.h"
 #include "Screen.h"
 #include "Transitions/FadeTransition.h"
 
@@ -65,13 +66,16 @@ void PlayScene::Exit()
     }
 }
 
-void PlayScene::DrawTo(Graphic::RenderTargetIf& renderTarget)
+void PlayScene::DrawTo(Graphic::RenderWindowIf& window)
 {
     for (const auto& entry : layers_) {
         auto& layer = entry.second;
-        layer->Clear();
-        layer->Draw();
-        layer->DrawTo(renderTarget);
+        if (IsDirectCompositionEnabled()) {
+            layer->DrawDirectTo(window);
+            continue;
+        }
+        layer->Redraw();
+        layer->DrawTo(window);
     }
 }
 
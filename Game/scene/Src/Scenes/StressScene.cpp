@@ -0,0 +1,127 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "StressScene.h"
+
+#include <string>
+
+#include <SFML/Graphics/Rect.hpp>
+
+#include "IntroScene.h"
+#include "Layers/HelperLayer.h"
+#include "Layers/StressLayer.h"
+#include "Message/BroadcastMessage/CloseWindowMessage.h"
+#include "Message/BroadcastMessage/KeyPressedMessage.h"
+#include "RenderWindowIf.h"
+#include "Screen.h"
+
+namespace FA {
+
+namespace Scene {
+
+StressScene::StressScene(Manager& sceneManager, Shared::MessageBus& messageBus, Shared::TextureManager& textureManager,
+                         Manager::Layers& layers, Manager::Data& data)
+    : BasicScene(sceneManager, messageBus, textureManager, layers, data)
+{}
+
+StressScene::~StressScene() = default;
+
+void StressScene::Enter()
+{
+    sf::IntRect rect(0, 0, Shared::Screen::width, Shared::Screen::height);
+    layers_.clear();
+    layers_[LayerId::Level] = std::make_unique<StressLayer>(messageBus_, rect, textureManager_, data_.stressScale_);
+    layers_[LayerId::Helper] =
+        std::make_unique<HelperLayer>(messageBus_, rect, Name() + " x" + std::to_string(data_.stressScale_));
+
+    Subscribe({Shared::MessageType::CloseWindow, Shared::MessageType::KeyPressed, Shared::MessageType::GameOver});
+
+    for (const auto& entry : layers_) {
+        auto& layer = entry.second;
+        layer->SubscribeMessages();
+    }
+
+    for (const auto& entry : layers_) {
+        auto& layer = entry.second;
+        layer->OnLoad();
+    }
+
+    for (const auto& entry : layers_) {
+        auto& layer = entry.second;
+        layer->OnCreate();
+    }
+}
+
+void StressScene::Exit()
+{
+    Unsubscribe({Shared::MessageType::CloseWindow, Shared::MessageType::KeyPressed, Shared::MessageType::GameOver});
+
+    for (const auto& entry : layers_) {
+        auto& layer = entry.second;
+        layer->UnsubscribeMessages();
+    }
+}
+
+void StressScene::DrawTo(Graphic::RenderWindowIf& window)
+{
+    for (const auto& entry : layers_) {
+        auto& layer = entry.second;
+        if (IsDirectCompositionEnabled()) {
+            layer->DrawDirectTo(window);
+            continue;
+        }
+        layer->Redraw();
+        layer->DrawTo(window);
+    }
+}
+
+void StressScene::Update(float deltaTime)
+{
+    for (const auto& entry : layers_) {
+        auto& layer = entry.second;
+        layer->Update(deltaTime);
+    }
+}
+
+void StressScene::OnMessage(std::shared_ptr<Shared::Message> msg)
+{
+    if (msg->GetMessageType() == Shared::MessageType::CloseWindow) {
+        auto m = std::dynamic_pointer_cast<Shared::CloseWindowMessage>(msg);
+        OnCloseWindow();
+    }
+    else if (msg->GetMessageType() == Shared::MessageType::KeyPressed) {
+        auto m = std::dynamic_pointer_cast<Shared::KeyPressedMessage>(msg);
+        auto key = m->GetKey();
+        if (key == sf::Keyboard::Key::Escape) {
+            SwitchScene<IntroScene>();
+        }
+        else if (key == sf::Keyboard::Key::Num1) {
+            Regenerate(1);
+        }
+        else if (key == sf::Keyboard::Key::Num2) {
+            Regenerate(10);
+        }
+        else if (key == sf::Keyboard::Key::Num3) {
+            Regenerate(100);
+        }
+        else if (key == sf::Keyboard::Key::Num4) {
+            Regenerate(1000);
+        }
+    }
+    else if (msg->GetMessageType() == Shared::MessageType::GameOver) {
+        Regenerate(data_.stressScale_);
+    }
+}
+
+void StressScene::Regenerate(unsigned int scale)
+{
+    data_.stressScale_ = scale;
+    SwitchScene<StressScene>();
+}
+
+}  // namespace Scene
+
+}  // namespace FA
@@ -0,0 +1,37 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include "BasicScene.h"
+
+namespace FA {
+
+namespace Scene {
+
+// Debug scene for scaling measurements, key 1-4 regenerates the level with 1x, 10x, 100x or 1000x content
+class StressScene : public BasicScene
+{
+public:
+    StressScene(Manager& sceneManager, Shared::MessageBus& messageBus, Shared::TextureManager& textureManager,
+                Manager::Layers& layers, Manager::Data& data);
+    virtual ~StressScene();
+
+    virtual void DrawTo(Graphic::RenderWindowIf& window) override;
+    virtual void Update(float deltaTime) override;
+    virtual std::string Name() const override { return "StressScene"; }
+    virtual void Enter() override;
+    virtual void Exit() override;
+
+private:
+    virtual void OnMessage(std::shared_ptr<Shared::Message> message) override;
+
+    void Regenerate(unsigned int scale);
+};
+
+}  // namespace Scene
+
+}  // namespace FA
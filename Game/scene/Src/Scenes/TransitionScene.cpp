@@ -9,6 +9,7 @@
 #include <SFML/Graphics/Rect.hpp>
 
 #include "Layers/HelperLayer.h"
+#include "RenderWindowIf.h"
 #include "Screen.h"
 #include "Transitions/BasicTransition.h"
 
@@ -48,14 +49,15 @@ void TransitionScene::Exit()
     }
 }
 
-void TransitionScene::DrawTo(Graphic::RenderTargetIf& renderTarget)
+void TransitionScene::DrawTo(Graphic::RenderWindowIf& window)
 {
     for (const auto& entry : layers_) {
         auto& layer = entry.second;
         layer->Clear();
         layer->Draw();
         layer->DrawTransition(*transition_);
-        layer->DrawTo(renderTarget);
+        layer->MarkDirty();  // the texture now has the transition drawn on top
+        layer->DrawTo(window);
     }
 }
 
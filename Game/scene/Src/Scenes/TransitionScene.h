@@ -21,7 +21,7 @@ public:
                     Manager::Layers& layers, Manager::Data& Data, std::unique_ptr<BasicTransition> transition);
     virtual ~TransitionScene();
 
-    virtual void DrawTo(Graphic::RenderTargetIf& renderTarget) override;
+    virtual void DrawTo(Graphic::RenderWindowIf& window) override;
     virtual void Update(float deltaTime) override;
     virtual std::string Name() const override { return "TransitionScene"; }
 
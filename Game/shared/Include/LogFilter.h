@@ -0,0 +1,107 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <atomic>
+
+#include "LogLevel.h"
+
+namespace FA {
+
+namespace Shared {
+
+enum class LogChannel { General, Entity, Scene, World, Resource };
+
+namespace Detail {
+
+constexpr unsigned int nLogChannelBits = 8;
+
+constexpr unsigned int LogBit(Util::LogLevel level, LogChannel channel)
+{
+    return 1u << (static_cast<unsigned int>(level) * nLogChannelBits + static_cast<unsigned int>(channel));
+}
+
+constexpr unsigned int LevelMask(Util::LogLevel minLevel)
+{
+    unsigned int mask = 0;
+    for (unsigned int level = static_cast<unsigned int>(minLevel);
+         level <= static_cast<unsigned int>(Util::LogLevel::Error); level++) {
+        mask |= ((1u << nLogChannelBits) - 1) << (level * nLogChannelBits);
+    }
+    return mask;
+}
+
+// One bit per level and channel, so a filter check is a single load and test
+inline std::atomic<unsigned int>& LogMask()
+{
+#ifdef _DEBUG
+    static std::atomic<unsigned int> mask{LevelMask(Util::LogLevel::Debug)};
+#else
+    static std::atomic<unsigned int> mask{LevelMask(Util::LogLevel::Info)};
+#endif
+    return mask;
+}
+
+inline std::atomic<unsigned int>& ChannelMask()
+{
+    static std::atomic<unsigned int> mask{(1u << nLogChannelBits) - 1};
+    return mask;
+}
+
+inline void UpdateLogMask(Util::LogLevel minLevel)
+{
+    unsigned int channels = ChannelMask().load(std::memory_order_relaxed);
+    unsigned int mask = 0;
+    for (unsigned int level = 0; level <= static_cast<unsigned int>(Util::LogLevel::Error); level++) {
+        mask |= channels << (level * nLogChannelBits);
+    }
+    LogMask().store(mask & LevelMask(minLevel), std::memory_order_relaxed);
+}
+
+inline std::atomic<Util::LogLevel>& MinLogLevel()
+{
+#ifdef _DEBUG
+    static std::atomic<Util::LogLevel> level{Util::LogLevel::Debug};
+#else
+    static std::atomic<Util::LogLevel> level{Util::LogLevel::Info};
+#endif
+    return level;
+}
+
+}  // namespace Detail
+
+inline bool IsLogEnabled(Util::LogLevel level, LogChannel channel)
+{
+    return (Detail::LogMask().load(std::memory_order_relaxed) & Detail::LogBit(level, channel)) != 0;
+}
+
+inline Util::LogLevel GetLogLevel()
+{
+    return Detail::MinLogLevel().load(std::memory_order_relaxed);
+}
+
+inline void SetLogLevel(Util::LogLevel minLevel)
+{
+    Detail::MinLogLevel().store(minLevel, std::memory_order_relaxed);
+    Detail::UpdateLogMask(minLevel);
+}
+
+inline void SetLogChannelEnabled(LogChannel channel, bool enabled)
+{
+    unsigned int bit = 1u << static_cast<unsigned int>(channel);
+    if (enabled) {
+        Detail::ChannelMask().fetch_or(bit, std::memory_order_relaxed);
+    }
+    else {
+        Detail::ChannelMask().fetch_and(~bit, std::memory_order_relaxed);
+    }
+    Detail::UpdateLogMask(GetLogLevel());
+}
+
+}  // namespace Shared
+
+}  // namespace FA
@@ -11,6 +11,7 @@
 #include <cstdarg>
 
 #include "Format.h"
+#include "LogFilter.h"
 #include "Print.h"
 
 namespace FA {
@@ -27,10 +28,38 @@ void MakeDebugLogEntry(const std::string& fn, const std::string& str);
 
 }  // namespace FA
 
-#define LOG_INFO(...) FA::Shared::MakeInfoLogEntry(__FUNCTION__, FA::Util::ToString(__VA_ARGS__))
-#define LOG_WARN(...) FA::Shared::MakeWarnLogEntry(__FUNCTION__, FA::Util::ToString(__VA_ARGS__))
-#define LOG_ERROR(...) FA::Shared::MakeErrorLogEntry(__FUNCTION__, FA::Util::ToString(__VA_ARGS__))
-#define LOG_DEBUG(...) FA::Shared::MakeDebugLogEntry(__FUNCTION__, FA::Util::ToString(__VA_ARGS__))
+// Define FA_LOG_CHANNEL before including this file to log a translation unit on another channel. Inline and template
+// code in headers is compiled in translation units with different channels, so it logs with the _CH macros instead
+#ifndef FA_LOG_CHANNEL
+#define FA_LOG_CHANNEL FA::Shared::LogChannel::General
+#endif
 
-#define LOG_INFO_ENTER_FUNC() FA::Shared::MakeInfoLogEntry(__FUNCTION__, "ENTER")
-#define LOG_INFO_EXIT_FUNC() FA::Shared::MakeInfoLogEntry(__FUNCTION__, "EXIT")
+// The filter is checked before the arguments are evaluated and formatted
+#define LOG_ENTRY_CH(channel, level, makeLogEntry, str)                \
+    do {                                                               \
+        if (FA::Shared::IsLogEnabled(level, channel)) {                \
+            makeLogEntry(__FUNCTION__, str);                           \
+        }                                                              \
+    } while (0)
+#define LOG_ENTRY(level, makeLogEntry, str) LOG_ENTRY_CH(FA_LOG_CHANNEL, level, makeLogEntry, str)
+
+#define LOG_INFO_CH(channel, ...) \
+    LOG_ENTRY_CH(channel, FA::Util::LogLevel::Info, FA::Shared::MakeInfoLogEntry, FA::Util::ToString(__VA_ARGS__))
+#define LOG_WARN_CH(channel, ...) \
+    LOG_ENTRY_CH(channel, FA::Util::LogLevel::Warn, FA::Shared::MakeWarnLogEntry, FA::Util::ToString(__VA_ARGS__))
+#define LOG_ERROR_CH(channel, ...) \
+    LOG_ENTRY_CH(channel, FA::Util::LogLevel::Error, FA::Shared::MakeErrorLogEntry, FA::Util::ToString(__VA_ARGS__))
+#ifdef _DEBUG
+#define LOG_DEBUG_CH(channel, ...) \
+    LOG_ENTRY_CH(channel, FA::Util::LogLevel::Debug, FA::Shared::MakeDebugLogEntry, FA::Util::ToString(__VA_ARGS__))
+#else
+#define LOG_DEBUG_CH(channel, ...) ((void)0)
+#endif  // _DEBUG
+
+#define LOG_INFO(...) LOG_INFO_CH(FA_LOG_CHANNEL, __VA_ARGS__)
+#define LOG_WARN(...) LOG_WARN_CH(FA_LOG_CHANNEL, __VA_ARGS__)
+#define LOG_ERROR(...) LOG_ERROR_CH(FA_LOG_CHANNEL, __VA_ARGS__)
+#define LOG_DEBUG(...) LOG_DEBUG_CH(FA_LOG_CHANNEL, __VA_ARGS__)
+
+#define LOG_INFO_ENTER_FUNC() LOG_ENTRY(FA::Util::LogLevel::Info, FA::Shared::MakeInfoLogEntry, "ENTER")
+#define LOG_INFO_EXIT_FUNC() LOG_ENTRY(FA::Util::LogLevel::Info, FA::Shared::MakeInfoLogEntry, "EXIT")
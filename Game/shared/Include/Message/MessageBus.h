@@ -6,8 +6,10 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -17,19 +19,32 @@ namespace FA {
 namespace Shared {
 
 class Message;
+class MessageBusStats;
 enum class MessageType;
 
+// Messages are delivered directly, unless sent between BeginDeferring and EndDeferring. Those are queued, from any
+// thread, and delivered in sent order by DispatchQueuedMessages. Outside that window only the thread calling
+// DispatchQueuedMessages may send, so subscribers are only called from that thread.
 class MessageBus
 {
 public:
     using MessageCB = std::function<void(std::shared_ptr<Message>)>;
 
+    MessageBus();
+    ~MessageBus();
+
     void AddSubscriber(const std::string& subscriber, MessageType messageType, MessageCB onMessage);
     void AddSubscriber(const std::string& subscriber, const std::vector<MessageType>& messageTypes,
                        MessageCB onMessage);
     void RemoveSubscriber(const std::string& subscriber, MessageType messageType);
     void RemoveSubscriber(const std::string& subscriber, const std::vector<MessageType>& messageTypes);
     void SendMessage(std::shared_ptr<Message> message);
+    void BeginDeferring();
+    void EndDeferring();
+    void DispatchQueuedMessages();
+    // Returns nullptr unless built with FA_MESSAGEBUS_STATS
+    const MessageBusStats* GetStats() const { return stats_.get(); }
+    void ResetStats();
 
 private:
     struct Subscriber
@@ -39,6 +54,14 @@ private:
     };
 
     std::unordered_map<MessageType, std::vector<Subscriber>> subscribersMap_;
+    std::unique_ptr<MessageBusStats> stats_;
+    std::atomic<bool> deferring_{false};
+    std::mutex queueMutex_;
+    std::vector<std::shared_ptr<Message>> queue_;
+    std::vector<std::shared_ptr<Message>> dispatching_;
+
+private:
+    void Dispatch(std::shared_ptr<Message> message);
 };
 
 }  // namespace Shared
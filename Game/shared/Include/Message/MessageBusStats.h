@@ -0,0 +1,72 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+
+namespace FA {
+
+namespace Shared {
+
+enum class MessageType;
+
+class MessageBusStats
+{
+public:
+    // Bucket n holds durations below 2^n microseconds, last bucket holds the rest
+    static constexpr std::size_t nBuckets = 16;
+
+    struct Histogram
+    {
+        void Add(std::chrono::nanoseconds duration);
+
+        std::array<unsigned int, nBuckets> buckets_{};
+    };
+
+    struct TypeStats
+    {
+        float AverageFanOut() const;
+
+        unsigned int nMessages_{};
+        unsigned int nDeliveries_{};
+        std::chrono::nanoseconds totalDuration_{};
+        Histogram histogram_;
+    };
+
+    struct SubscriberStats
+    {
+        std::chrono::nanoseconds AverageDuration() const;
+
+        unsigned int nCalls_{};
+        std::chrono::nanoseconds totalDuration_{};
+        std::chrono::nanoseconds maxDuration_{};
+        Histogram histogram_;
+    };
+
+    void AddMessage(MessageType messageType, unsigned int fanOut, std::chrono::nanoseconds duration);
+    void AddHandlerCall(const std::string& subscriber, std::chrono::nanoseconds duration);
+    const std::unordered_map<MessageType, TypeStats>& GetTypeStats() const { return typeStats_; }
+    const std::unordered_map<std::string, SubscriberStats>& GetSubscriberStats() const { return subscriberStats_; }
+    void Reset();
+    void WriteTo(std::ostream& os) const;
+    bool Dump(const std::string& filePath) const;
+
+private:
+    std::unordered_map<MessageType, TypeStats> typeStats_;
+    std::unordered_map<std::string, SubscriberStats> subscriberStats_;
+
+private:
+    static std::ostream& WriteHistogram(std::ostream& os, const Histogram& histogram);
+};
+
+}  // namespace Shared
+
+}  // namespace FA
@@ -6,6 +6,9 @@
 
 #pragma once
 
+#include <ostream>
+#include <string>
+
 namespace FA {
 
 namespace Shared {
@@ -21,6 +24,41 @@ enum class MessageType {
     GameOver
 };
 
+inline std::ostream& operator<<(std::ostream& os, const MessageType& e)
+{
+    std::string str;
+    switch (e) {
+        case MessageType::Undefined:
+            str = "Undefined";
+            break;
+        case MessageType::KeyPressed:
+            str = "KeyPressed";
+            break;
+        case MessageType::KeyReleased:
+            str = "KeyReleased";
+            break;
+        case MessageType::IsKeyPressed:
+            str = "IsKeyPressed";
+            break;
+        case MessageType::CloseWindow:
+            str = "CloseWindow";
+            break;
+        case MessageType::EntityInitialized:
+            str = "EntityInitialized";
+            break;
+        case MessageType::EntityDestroyed:
+            str = "EntityDestroyed";
+            break;
+        case MessageType::GameOver:
+            str = "GameOver";
+            break;
+    }
+
+    os << str;
+
+    return os;
+}
+
 }  // namespace Shared
 
 }  // namespace FA
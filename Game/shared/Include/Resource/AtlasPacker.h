@@ -0,0 +1,44 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <SFML/System/Vector2.hpp>
+
+namespace FA {
+
+namespace Shared {
+
+// Places rectangles on shelves in pages of fixed size, highest rectangle first. A new shelf is started when a
+// rectangle doesn't fit to the right on the current shelf, and a new page when it doesn't fit below. Each rectangle
+// gets padding on all sides, so sampling just outside it doesn't hit a neighbour.
+class AtlasPacker
+{
+public:
+    struct Placement
+    {
+        bool isPacked_ = false;  // false when larger than a page
+        unsigned int page_{};
+        sf::Vector2u position_;  // top left corner, inside the padding
+    };
+
+    AtlasPacker(const sf::Vector2u &pageSize, unsigned int padding);
+
+    std::vector<Placement> Pack(const std::vector<sf::Vector2u> &sizes);
+    unsigned int GetPageCount() const { return static_cast<unsigned int>(usedSizes_.size()); }
+    sf::Vector2u GetUsedSize(unsigned int page) const { return usedSizes_.at(page); }
+
+private:
+    sf::Vector2u pageSize_;
+    unsigned int padding_{};
+    std::vector<sf::Vector2u> usedSizes_;
+};
+
+}  // namespace Shared
+
+}  // namespace FA
@@ -30,7 +30,7 @@ public:
     {
         auto it = paths_.find(path);
         if (it != paths_.end()) {
-            LOG_WARN("%s is already loaded", DUMP(path));
+            LOG_WARN_CH(FA::Shared::LogChannel::Resource, "%s is already loaded", DUMP(path));
             return paths_.at(path);
         }
 
@@ -40,22 +40,46 @@ public:
             paths_[path] = id_;
             resources_.emplace(id_, std::move(resource));
             auto n = resources_.size();
-            LOG_INFO("Loaded %u resource(s)", n);
+            LOG_INFO_CH(FA::Shared::LogChannel::Resource, "Loaded %u resource(s)", n);
             return id_++;
         }
         else {
-            LOG_ERROR("Could not load %s", DUMP(path));
+            LOG_ERROR_CH(FA::Shared::LogChannel::Resource, "Could not load %s", DUMP(path));
             return InvalidResourceId;
         }
     }
 
+    // Empty resource from the factory, to be filled in memory and then added
+    std::unique_ptr<R> Create() const { return createFn_(); }
+
+    // For resources created in memory, the name is used as path
+    ResourceId Add(const std::string& name, std::unique_ptr<R> resource)
+    {
+        auto it = paths_.find(name);
+        if (it != paths_.end()) {
+            LOG_WARN_CH(FA::Shared::LogChannel::Resource, "%s is already added", DUMP(name));
+            return it->second;
+        }
+
+        paths_[name] = id_;
+        resources_.emplace(id_, std::move(resource));
+        return id_++;
+    }
+
+    ResourceId Find(const std::string& path) const
+    {
+        auto it = paths_.find(path);
+
+        return it != paths_.end() ? it->second : InvalidResourceId;
+    }
+
     const R* Get(ResourceId id) const
     {
         auto it = resources_.find(id);
 
         if (it != resources_.end()) return it->second.get();
 
-        LOG_ERROR("Could not get %s", DUMP(id));
+        LOG_ERROR_CH(FA::Shared::LogChannel::Resource, "Could not get %s", DUMP(id));
 
         return nullptr;
     }
@@ -6,11 +6,17 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
+#include <SFML/System/Vector2.hpp>
+
+#include "SfmlFwd.h"
 #include "SpriteSheetIf.h"
+#include "TextureManager.h"
 
 namespace FA {
 
@@ -21,13 +27,34 @@ struct SheetItem;
 class SheetManager
 {
 public:
+    using LoadImageFn = std::function<bool(const std::string &path, sf::Image &image)>;
+    using ReadImageSizeFn = std::function<bool(const std::string &path, sf::Vector2u &size)>;
+
+    SheetManager();
+    SheetManager(LoadImageFn loadImageFn, ReadImageSizeFn readImageSizeFn);
+
     void AddSheet(const std::string &name, std::unique_ptr<SpriteSheetIf> sheet);
+    // Image sheets are added when BuildAtlas packs them into atlas textures, a few textures instead of one per image
+    void AddImageSheet(const std::string &name, const std::string &path, const sf::Vector2u &rectCount);
+    void BuildAtlas(TextureManager &textureManager);
     TextureRect GetTextureRect(const SheetItem &item) const;
 
+private:
+    struct ImageSheet
+    {
+        std::string name_;
+        std::string path_;
+        sf::Vector2u rectCount_;
+    };
+
 private:
     std::unordered_map<std::string, std::unique_ptr<SpriteSheetIf>> sheetMap_;
+    std::vector<ImageSheet> imageSheets_;
+    LoadImageFn loadImageFn_;
+    ReadImageSizeFn readImageSizeFn_;
 
 private:
+    void DecodeImage(const std::string &path, sf::Image &image) const;
     SpriteSheetIf *GetSheet(const std::string &sheetId) const;
 };
 
@@ -20,7 +20,8 @@ class SpriteSheet : public SpriteSheetIf
 {
 public:
     SpriteSheet() = default;
-    SpriteSheet(ResourceId textureId, const sf::Vector2u& textureSize, const sf::Vector2u& rectCount);
+    SpriteSheet(ResourceId textureId, const sf::Vector2u& textureSize, const sf::Vector2u& rectCount,
+                const sf::Vector2u& offset = {});  // offset of sheet in texture, when part of an atlas
 
     virtual TextureRect At(const sf::Vector2u& uvCoord) const override;
 
@@ -28,6 +29,7 @@ private:
     ResourceId textureId_;
     sf::Vector2u textureSize_;
     sf::Vector2u rectCount_;
+    sf::Vector2u offset_;
     bool isValid_ = false;
     sf::Vector2u rectSize_;
 };
@@ -42,7 +42,7 @@ public:
     {
         isCompleted_ = false;
         if (IsEmpty()) {
-            LOG_WARN("Can't start sequence, no elements");
+            LOG_WARN_CH(FA::Shared::LogChannel::General, "Can't start sequence, no elements");
         }
         else {
             isStopped_ = false;
@@ -62,7 +62,7 @@ public:
     virtual void Add(const T &element) override
     {
         if (!isStopped_) {
-            LOG_WARN("Can't add element when sequence is started");
+            LOG_WARN_CH(FA::Shared::LogChannel::General, "Can't add element when sequence is started");
             return;
         }
 
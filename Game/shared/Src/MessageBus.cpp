@@ -6,12 +6,26 @@
 
 #include "Message/MessageBus.h"
 
+#ifdef FA_MESSAGEBUS_STATS
+#include <chrono>
+#endif
+
 #include "Message/Message.h"
+#include "Message/MessageBusStats.h"
 
 namespace FA {
 
 namespace Shared {
 
+MessageBus::MessageBus()
+{
+#ifdef FA_MESSAGEBUS_STATS
+    stats_ = std::make_unique<MessageBusStats>();
+#endif
+}
+
+MessageBus::~MessageBus() = default;
+
 void MessageBus::AddSubscriber(const std::string& subscriber, MessageType messageType, MessageCB onMessage)
 {
     auto& subscribers = subscribersMap_[messageType];
@@ -45,12 +59,65 @@ void MessageBus::RemoveSubscriber(const std::string& subscriber, const std::vect
 }
 
 void MessageBus::SendMessage(std::shared_ptr<Message> msg)
+{
+    if (deferring_) {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        queue_.push_back(msg);
+        return;
+    }
+
+    Dispatch(msg);
+}
+
+void MessageBus::BeginDeferring()
+{
+    deferring_ = true;
+}
+
+void MessageBus::EndDeferring()
+{
+    deferring_ = false;
+}
+
+void MessageBus::DispatchQueuedMessages()
+{
+    {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        dispatching_.swap(queue_);
+    }
+    for (auto& msg : dispatching_) {
+        Dispatch(msg);
+    }
+    dispatching_.clear();
+}
+
+void MessageBus::Dispatch(std::shared_ptr<Message> msg)
 {
     auto type = msg->GetMessageType();
     const auto& subscribers = subscribersMap_[type];
+#ifdef FA_MESSAGEBUS_STATS
+    using Clock = std::chrono::steady_clock;
+    unsigned int fanOut = 0;
+    auto sendStart = Clock::now();
+    for (const auto& subscriber : subscribers) {
+        if (subscriber.onMessage_ != nullptr) {
+            auto start = Clock::now();
+            subscriber.onMessage_(msg);
+            stats_->AddHandlerCall(subscriber.name_, Clock::now() - start);
+            fanOut++;
+        }
+    }
+    stats_->AddMessage(type, fanOut, Clock::now() - sendStart);
+#else
     for (const auto& subscriber : subscribers) {
         if (subscriber.onMessage_ != nullptr) subscriber.onMessage_(msg);
     }
+#endif
+}
+
+void MessageBus::ResetStats()
+{
+    if (stats_) stats_->Reset();
 }
 
 }  // namespace Shared
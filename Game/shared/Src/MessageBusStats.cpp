@@ -0,0 +1,117 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "Message/MessageBusStats.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <vector>
+
+#include "Message/MessageType.h"
+
+namespace FA {
+
+namespace Shared {
+
+void MessageBusStats::Histogram::Add(std::chrono::nanoseconds duration)
+{
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+    std::size_t bucket = 0;
+    while (bucket < nBuckets - 1 && us >= (1ll << bucket)) {
+        bucket++;
+    }
+    buckets_[bucket]++;
+}
+
+float MessageBusStats::TypeStats::AverageFanOut() const
+{
+    return nMessages_ > 0 ? static_cast<float>(nDeliveries_) / nMessages_ : 0.0f;
+}
+
+std::chrono::nanoseconds MessageBusStats::SubscriberStats::AverageDuration() const
+{
+    return nCalls_ > 0 ? totalDuration_ / nCalls_ : std::chrono::nanoseconds{};
+}
+
+void MessageBusStats::AddMessage(MessageType messageType, unsigned int fanOut, std::chrono::nanoseconds duration)
+{
+    auto& stats = typeStats_[messageType];
+    stats.nMessages_++;
+    stats.nDeliveries_ += fanOut;
+    stats.totalDuration_ += duration;
+    stats.histogram_.Add(duration);
+}
+
+void MessageBusStats::AddHandlerCall(const std::string& subscriber, std::chrono::nanoseconds duration)
+{
+    auto& stats = subscriberStats_[subscriber];
+    stats.nCalls_++;
+    stats.totalDuration_ += duration;
+    stats.maxDuration_ = std::max(stats.maxDuration_, duration);
+    stats.histogram_.Add(duration);
+}
+
+void MessageBusStats::Reset()
+{
+    typeStats_.clear();
+    subscriberStats_.clear();
+}
+
+void MessageBusStats::WriteTo(std::ostream& os) const
+{
+    using namespace std::chrono;
+
+    os << "Message types" << std::endl;
+    for (const auto& entry : typeStats_) {
+        const auto& stats = entry.second;
+        os << "  " << std::left << std::setw(20) << entry.first << std::right << " sent: " << stats.nMessages_
+           << " fan-out: " << std::fixed << std::setprecision(2) << stats.AverageFanOut()
+           << " total us: " << duration_cast<microseconds>(stats.totalDuration_).count() << " histogram: ";
+        WriteHistogram(os, stats.histogram_) << std::endl;
+    }
+
+    // Most expensive subscriber first
+    std::vector<std::pair<std::string, SubscriberStats>> subscribers(subscriberStats_.begin(),
+                                                                     subscriberStats_.end());
+    std::sort(subscribers.begin(), subscribers.end(),
+              [](const auto& a, const auto& b) { return a.second.totalDuration_ > b.second.totalDuration_; });
+
+    os << "Subscribers" << std::endl;
+    for (const auto& entry : subscribers) {
+        const auto& stats = entry.second;
+        os << "  " << std::left << std::setw(20) << entry.first << std::right << " calls: " << stats.nCalls_
+           << " total us: " << duration_cast<microseconds>(stats.totalDuration_).count()
+           << " avg ns: " << stats.AverageDuration().count() << " max ns: " << stats.maxDuration_.count()
+           << " histogram: ";
+        WriteHistogram(os, stats.histogram_) << std::endl;
+    }
+}
+
+bool MessageBusStats::Dump(const std::string& filePath) const
+{
+    std::ofstream os(filePath);
+    if (!os.is_open()) return false;
+
+    WriteTo(os);
+
+    return true;
+}
+
+std::ostream& MessageBusStats::WriteHistogram(std::ostream& os, const Histogram& histogram)
+{
+    os << "[";
+    for (std::size_t i = 0; i < nBuckets; i++) {
+        os << (i > 0 ? " " : "") << histogram.buckets_[i];
+    }
+    os << "]";
+
+    return os;
+}
+
+}  // namespace Shared
+
+}  // namespace FA
@@ -0,0 +1,64 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "Resource/AtlasPacker.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace FA {
+
+namespace Shared {
+
+AtlasPacker::AtlasPacker(const sf::Vector2u& pageSize, unsigned int padding)
+    : pageSize_(pageSize)
+    , padding_(padding)
+{}
+
+std::vector<AtlasPacker::Placement> AtlasPacker::Pack(const std::vector<sf::Vector2u>& sizes)
+{
+    std::vector<std::size_t> order(sizes.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&sizes](auto a, auto b) { return sizes[a].y > sizes[b].y; });
+
+    std::vector<Placement> placements(sizes.size());
+    usedSizes_.clear();
+    sf::Vector2u cursor;
+    unsigned int shelfHeight = 0;
+    for (auto i : order) {
+        sf::Vector2u padded(sizes[i].x + 2 * padding_, sizes[i].y + 2 * padding_);
+        if (padded.x > pageSize_.x || padded.y > pageSize_.y) continue;
+
+        if (usedSizes_.empty()) {
+            usedSizes_.emplace_back();
+        }
+        if (cursor.x + padded.x > pageSize_.x) {
+            cursor = {0, cursor.y + shelfHeight};
+            shelfHeight = 0;
+        }
+        if (cursor.y + padded.y > pageSize_.y) {
+            usedSizes_.emplace_back();
+            cursor = {0, 0};
+            shelfHeight = 0;
+        }
+
+        auto& placement = placements[i];
+        placement.isPacked_ = true;
+        placement.page_ = GetPageCount() - 1;
+        placement.position_ = {cursor.x + padding_, cursor.y + padding_};
+        auto& used = usedSizes_.back();
+        used.x = std::max(used.x, cursor.x + padded.x);
+        used.y = std::max(used.y, cursor.y + padded.y);
+        cursor.x += padded.x;
+        shelfHeight = std::max(shelfHeight, padded.y);
+    }
+
+    return placements;
+}
+
+}  // namespace Shared
+
+}  // namespace FA
@@ -4,9 +4,18 @@
  *	See file LICENSE for full license details.
  */
 
+#define FA_LOG_CHANNEL FA::Shared::LogChannel::Resource
+
 #include "Resource/SheetManager.h"
 
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#include <SFML/Graphics/Image.hpp>
+
 #include "Logging.h"
+#include "Resource/AtlasPacker.h"
 #include "Resource/SheetItem.h"
 #include "Resource/SpriteSheet.h"
 #include "Resource/TextureRect.h"
@@ -15,11 +24,141 @@ namespace FA {
 
 namespace Shared {
 
+namespace {
+
+// Supported by all gpus the game runs on
+const sf::Vector2u atlasPageSize{2048, 2048};
+const unsigned int atlasPadding = 2;
+
+// The padding is filled with the edge pixels of the image, so rounding outside the image samples the same color
+void CopyExtruded(sf::Image& page, const sf::Image& image, const sf::Vector2u& position)
+{
+    page.copy(image, position.x, position.y);
+    auto size = image.getSize();
+    if (size.x == 0 || size.y == 0) return;
+
+    int pad = static_cast<int>(atlasPadding);
+    int w = static_cast<int>(size.x);
+    int h = static_cast<int>(size.y);
+    for (int y = -pad; y < h + pad; y++) {
+        for (int x = -pad; x < w + pad; x++) {
+            if (x >= 0 && x < w && y >= 0 && y < h) continue;
+            int srcX = std::min(std::max(x, 0), w - 1);
+            int srcY = std::min(std::max(y, 0), h - 1);
+            page.setPixel(position.x + x, position.y + y, image.getPixel(srcX, srcY));
+        }
+    }
+}
+
+// The size is in the IHDR chunk that follows the png signature, so it is read without decoding the image
+bool ReadPngSize(const std::string& path, sf::Vector2u& size)
+{
+    const unsigned char signature[] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n', 0, 0, 0, 13, 'I', 'H', 'D', 'R'};
+    unsigned char header[24];
+    std::ifstream file(path, std::ios::binary);
+    if (!file.read(reinterpret_cast<char*>(header), sizeof(header))) return false;
+    if (std::memcmp(header, signature, sizeof(signature)) != 0) return false;
+
+    auto readU32 = [&header](int offset) {
+        return (static_cast<unsigned int>(header[offset]) << 24) | (header[offset + 1] << 16) |
+               (header[offset + 2] << 8) | header[offset + 3];
+    };
+    size = {readU32(16), readU32(20)};
+
+    return true;
+}
+
+}  // namespace
+
+SheetManager::SheetManager()
+    : loadImageFn_([](const std::string& path, sf::Image& image) { return image.loadFromFile(path); })
+    , readImageSizeFn_(ReadPngSize)
+{}
+
+SheetManager::SheetManager(LoadImageFn loadImageFn, ReadImageSizeFn readImageSizeFn)
+    : loadImageFn_(loadImageFn)
+    , readImageSizeFn_(readImageSizeFn)
+{}
+
 void SheetManager::AddSheet(const std::string& name, std::unique_ptr<SpriteSheetIf> sheet)
 {
     sheetMap_.insert({name, std::move(sheet)});
 }
 
+void SheetManager::AddImageSheet(const std::string& name, const std::string& path, const sf::Vector2u& rectCount)
+{
+    imageSheets_.push_back({name, path, rectCount});
+}
+
+// Images are only decoded for atlas pages that are not already in textureManager, the packing only needs their size
+void SheetManager::BuildAtlas(TextureManager& textureManager)
+{
+    std::vector<sf::Image> images(imageSheets_.size());
+    std::vector<bool> isLoaded(imageSheets_.size(), false);
+    std::vector<sf::Vector2u> sizes(imageSheets_.size());
+    // Levels with the same sheets share the atlas
+    std::string atlasName = "atlas";
+    for (std::size_t i = 0; i < imageSheets_.size(); i++) {
+        const auto& path = imageSheets_[i].path_;
+        if (!readImageSizeFn_(path, sizes[i])) {
+            DecodeImage(path, images[i]);
+            isLoaded[i] = true;
+            sizes[i] = images[i].getSize();
+        }
+        atlasName += ";" + path;
+    }
+
+    AtlasPacker packer(atlasPageSize, atlasPadding);
+    auto placements = packer.Pack(sizes);
+    std::vector<ResourceId> pageIds;
+    for (unsigned int page = 0; page < packer.GetPageCount(); page++) {
+        auto pageName = atlasName + "#" + std::to_string(page);
+        auto id = textureManager.Find(pageName);
+        if (id == InvalidResourceId) {
+            auto size = packer.GetUsedSize(page);
+            sf::Image pageImage;
+            pageImage.create(size.x, size.y, sf::Color::Transparent);
+            for (std::size_t i = 0; i < placements.size(); i++) {
+                if (placements[i].isPacked_ && placements[i].page_ == page) {
+                    if (!isLoaded[i]) DecodeImage(imageSheets_[i].path_, images[i]);
+                    CopyExtruded(pageImage, images[i], placements[i].position_);
+                }
+            }
+            auto texture = textureManager.Create();
+            texture->loadFromImage(pageImage);
+            id = textureManager.Add(pageName, std::move(texture));
+        }
+        pageIds.push_back(id);
+    }
+
+    for (std::size_t i = 0; i < imageSheets_.size(); i++) {
+        const auto& imageSheet = imageSheets_[i];
+        const auto& placement = placements[i];
+        if (placement.isPacked_) {
+            auto sheet = std::make_unique<SpriteSheet>(pageIds[placement.page_], sizes[i], imageSheet.rectCount_,
+                                                       placement.position_);
+            AddSheet(imageSheet.name_, std::move(sheet));
+        }
+        else {
+            ResourceId id = textureManager.Load(imageSheet.path_);
+            auto texture = textureManager.Get(id);
+            sf::Vector2u size = texture != nullptr ? texture->getSize() : sf::Vector2u();
+            AddSheet(imageSheet.name_, std::make_unique<SpriteSheet>(id, size, imageSheet.rectCount_));
+        }
+    }
+
+    LOG_INFO("Packed %u sheets in %u atlas textures", static_cast<unsigned int>(imageSheets_.size()),
+             packer.GetPageCount());
+    imageSheets_.clear();
+}
+
+void SheetManager::DecodeImage(const std::string& path, sf::Image& image) const
+{
+    if (!loadImageFn_(path, image)) {
+        LOG_ERROR("Could not load %s", DUMP(path));
+    }
+}
+
 TextureRect SheetManager::GetTextureRect(const SheetItem& item) const
 {
     auto sheet = GetSheet(item.id_);
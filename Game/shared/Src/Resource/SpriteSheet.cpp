@@ -4,6 +4,8 @@
  *	See file LICENSE for full license details.
  */
 
+#define FA_LOG_CHANNEL FA::Shared::LogChannel::Resource
+
 #include <SFML/Graphics/Rect.hpp>
 
 #include "Resource/SpriteSheet.h"
@@ -14,10 +16,12 @@ namespace FA {
 
 namespace Shared {
 
-SpriteSheet::SpriteSheet(ResourceId textureId, const sf::Vector2u& textureSize, const sf::Vector2u& rectCount)
+SpriteSheet::SpriteSheet(ResourceId textureId, const sf::Vector2u& textureSize, const sf::Vector2u& rectCount,
+                         const sf::Vector2u& offset)
     : textureId_(textureId)
     , textureSize_(textureSize)
     , rectCount_(rectCount)
+    , offset_(offset)
     , isValid_(true)
 {
     if (rectCount_.x == 0 || rectCount_.y == 0 || textureSize_.x == 0 || textureSize_.y == 0) {
@@ -39,8 +43,8 @@ TextureRect SpriteSheet::At(const sf::Vector2u& uvCoord) const
             return {};
         }
 
-        int left = static_cast<int>(uvCoord.x * rectSize_.x);
-        int top = static_cast<int>(uvCoord.y * rectSize_.y);
+        int left = static_cast<int>(offset_.x + uvCoord.x * rectSize_.x);
+        int top = static_cast<int>(offset_.y + uvCoord.y * rectSize_.y);
         int width = static_cast<int>(rectSize_.x);
         int height = static_cast<int>(rectSize_.y);
         return TextureRect(textureId_, {left, top, width, height});
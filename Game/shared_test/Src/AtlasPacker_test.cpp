@@ -0,0 +1,58 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "Resource/AtlasPacker.h"
+
+using namespace testing;
+
+namespace FA {
+
+namespace Shared {
+
+TEST(AtlasPackerTest, PackShouldPlaceHighestFirstWithPadding)
+{
+    AtlasPacker packer({100, 100}, 1);
+    auto placements = packer.Pack({{10, 10}, {20, 30}});
+
+    ASSERT_EQ(placements.size(), 2u);
+    EXPECT_TRUE(placements[1].isPacked_);
+    EXPECT_EQ(placements[1].position_, sf::Vector2u(1, 1));
+    EXPECT_TRUE(placements[0].isPacked_);
+    EXPECT_EQ(placements[0].position_, sf::Vector2u(23, 1));
+    EXPECT_EQ(packer.GetPageCount(), 1u);
+    EXPECT_EQ(packer.GetUsedSize(0), sf::Vector2u(34, 32));
+}
+
+TEST(AtlasPackerTest, PackShouldStartNewShelfAndNewPageWhenFull)
+{
+    AtlasPacker packer({50, 50}, 0);
+    auto placements = packer.Pack({{30, 30}, {30, 20}, {30, 30}});
+
+    EXPECT_EQ(placements[0].page_, 0u);
+    EXPECT_EQ(placements[0].position_, sf::Vector2u(0, 0));
+    EXPECT_EQ(placements[2].page_, 1u);
+    EXPECT_EQ(placements[2].position_, sf::Vector2u(0, 0));
+    EXPECT_EQ(placements[1].page_, 1u);
+    EXPECT_EQ(placements[1].position_, sf::Vector2u(0, 30));
+    EXPECT_EQ(packer.GetPageCount(), 2u);
+}
+
+TEST(AtlasPackerTest, PackShouldNotPlaceRectangleLargerThanPage)
+{
+    AtlasPacker packer({50, 50}, 1);
+    auto placements = packer.Pack({{49, 10}, {10, 10}});
+
+    EXPECT_FALSE(placements[0].isPacked_);
+    EXPECT_TRUE(placements[1].isPacked_);
+    EXPECT_EQ(packer.GetPageCount(), 1u);
+}
+
+}  // namespace Shared
+
+}  // namespace FA
@@ -0,0 +1,81 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "Logging.h"
+#include "Mock/LoggerMock.h"
+
+using namespace testing;
+
+namespace FA {
+
+namespace Shared {
+
+class LogFilterTest : public Test
+{
+protected:
+    void SetUp() override { prevLevel_ = GetLogLevel(); }
+
+    void TearDown() override
+    {
+        SetLogChannelEnabled(LogChannel::General, true);
+        SetLogChannelEnabled(LogChannel::Entity, true);
+        SetLogLevel(prevLevel_);
+    }
+
+    StrictMock<LoggerMock> loggerMock_;
+
+private:
+    Util::LogLevel prevLevel_{};
+};
+
+TEST_F(LogFilterTest, LevelBelowMinLevelShouldBeDisabled)
+{
+    SetLogLevel(Util::LogLevel::Warn);
+
+    EXPECT_FALSE(IsLogEnabled(Util::LogLevel::Debug, LogChannel::General));
+    EXPECT_FALSE(IsLogEnabled(Util::LogLevel::Info, LogChannel::General));
+    EXPECT_TRUE(IsLogEnabled(Util::LogLevel::Warn, LogChannel::General));
+    EXPECT_TRUE(IsLogEnabled(Util::LogLevel::Error, LogChannel::General));
+}
+
+TEST_F(LogFilterTest, DisabledChannelShouldBeDisabledForAllLevels)
+{
+    SetLogChannelEnabled(LogChannel::Entity, false);
+
+    EXPECT_FALSE(IsLogEnabled(Util::LogLevel::Error, LogChannel::Entity));
+    EXPECT_TRUE(IsLogEnabled(Util::LogLevel::Error, LogChannel::General));
+
+    SetLogLevel(Util::LogLevel::Info);
+    EXPECT_FALSE(IsLogEnabled(Util::LogLevel::Error, LogChannel::Entity));
+
+    SetLogChannelEnabled(LogChannel::Entity, true);
+    EXPECT_TRUE(IsLogEnabled(Util::LogLevel::Info, LogChannel::Entity));
+    EXPECT_FALSE(IsLogEnabled(Util::LogLevel::Debug, LogChannel::Entity));
+}
+
+TEST_F(LogFilterTest, FilteredLogEntryShouldNotFormatArguments)
+{
+    SetLogLevel(Util::LogLevel::Error);
+    int nFormatted = 0;
+    auto arg = [&nFormatted]() {
+        nFormatted++;
+        return "value";
+    };
+
+    LOG_WARN("%s", arg());
+    EXPECT_EQ(nFormatted, 0);
+
+    EXPECT_CALL(loggerMock_, MakeErrorLogEntry("value"));
+    LOG_ERROR("%s", arg());
+    EXPECT_EQ(nFormatted, 1);
+}
+
+}  // namespace Shared
+
+}  // namespace FA
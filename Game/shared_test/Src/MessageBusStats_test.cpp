@@ -0,0 +1,96 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <sstream>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "Message/MessageBusStats.h"
+#include "Message/MessageType.h"
+
+using namespace testing;
+using namespace std::chrono_literals;
+
+namespace FA {
+
+namespace Shared {
+
+class MessageBusStatsTest : public Test
+{
+protected:
+    MessageBusStats stats_;
+};
+
+TEST_F(MessageBusStatsTest, AddMessageShouldAccumulatePerType)
+{
+    stats_.AddMessage(MessageType::KeyPressed, 3, 10us);
+    stats_.AddMessage(MessageType::KeyPressed, 1, 20us);
+    stats_.AddMessage(MessageType::GameOver, 0, 1us);
+
+    const auto& typeStats = stats_.GetTypeStats();
+    ASSERT_THAT(typeStats, SizeIs(2));
+    const auto& keyPressed = typeStats.at(MessageType::KeyPressed);
+    EXPECT_EQ(keyPressed.nMessages_, 2u);
+    EXPECT_EQ(keyPressed.nDeliveries_, 4u);
+    EXPECT_FLOAT_EQ(keyPressed.AverageFanOut(), 2.0f);
+    EXPECT_EQ(keyPressed.totalDuration_, 30us);
+    EXPECT_FLOAT_EQ(typeStats.at(MessageType::GameOver).AverageFanOut(), 0.0f);
+}
+
+TEST_F(MessageBusStatsTest, AddHandlerCallShouldAccumulatePerSubscriber)
+{
+    stats_.AddHandlerCall("Player", 100ns);
+    stats_.AddHandlerCall("Player", 300ns);
+
+    const auto& player = stats_.GetSubscriberStats().at("Player");
+    EXPECT_EQ(player.nCalls_, 2u);
+    EXPECT_EQ(player.totalDuration_, 400ns);
+    EXPECT_EQ(player.maxDuration_, 300ns);
+    EXPECT_EQ(player.AverageDuration(), 200ns);
+}
+
+TEST_F(MessageBusStatsTest, HistogramShouldBucketByPowerOfTwoMicroseconds)
+{
+    MessageBusStats::Histogram histogram;
+    histogram.Add(500ns);
+    histogram.Add(1us);
+    histogram.Add(3us);
+    histogram.Add(4us);
+    histogram.Add(10s);
+
+    EXPECT_EQ(histogram.buckets_[0], 1u);
+    EXPECT_EQ(histogram.buckets_[1], 1u);
+    EXPECT_EQ(histogram.buckets_[2], 1u);
+    EXPECT_EQ(histogram.buckets_[3], 1u);
+    EXPECT_EQ(histogram.buckets_[MessageBusStats::nBuckets - 1], 1u);
+}
+
+TEST_F(MessageBusStatsTest, ResetShouldClearAllStats)
+{
+    stats_.AddMessage(MessageType::KeyPressed, 1, 1us);
+    stats_.AddHandlerCall("Player", 1us);
+    stats_.Reset();
+
+    EXPECT_THAT(stats_.GetTypeStats(), IsEmpty());
+    EXPECT_THAT(stats_.GetSubscriberStats(), IsEmpty());
+}
+
+TEST_F(MessageBusStatsTest, WriteToShouldListTypesAndSubscribers)
+{
+    stats_.AddMessage(MessageType::KeyPressed, 2, 1us);
+    stats_.AddHandlerCall("Player", 1us);
+    std::stringstream ss;
+    stats_.WriteTo(ss);
+
+    EXPECT_THAT(ss.str(), HasSubstr("KeyPressed"));
+    EXPECT_THAT(ss.str(), HasSubstr("fan-out: 2.00"));
+    EXPECT_THAT(ss.str(), HasSubstr("Player"));
+}
+
+}  // namespace Shared
+
+}  // namespace FA
@@ -0,0 +1,94 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "Message/BroadcastMessage/KeyPressedMessage.h"
+#include "Message/MessageBus.h"
+#include "Message/MessageType.h"
+
+using namespace testing;
+
+namespace FA {
+
+namespace Shared {
+
+class MessageBusTest : public Test
+{
+protected:
+    void SetUp() override
+    {
+        messageBus_.AddSubscriber("subscriber", MessageType::KeyPressed, [this](std::shared_ptr<Message> msg) {
+            keys_.push_back(std::dynamic_pointer_cast<KeyPressedMessage>(msg)->GetKey());
+            threadIds_.push_back(std::this_thread::get_id());
+        });
+    }
+
+    void Send(sf::Keyboard::Key key) { messageBus_.SendMessage(std::make_shared<KeyPressedMessage>(key)); }
+
+    MessageBus messageBus_;
+    std::vector<sf::Keyboard::Key> keys_;
+    std::vector<std::thread::id> threadIds_;
+};
+
+TEST_F(MessageBusTest, SendMessageShouldDeliverDirectly)
+{
+    Send(sf::Keyboard::Key::Right);
+
+    EXPECT_THAT(keys_, ElementsAre(sf::Keyboard::Key::Right));
+}
+
+TEST_F(MessageBusTest, SendMessageWhileDeferringShouldQueueUntilDispatch)
+{
+    messageBus_.BeginDeferring();
+    Send(sf::Keyboard::Key::Right);
+    messageBus_.EndDeferring();
+
+    EXPECT_THAT(keys_, IsEmpty());
+    messageBus_.DispatchQueuedMessages();
+    EXPECT_THAT(keys_, ElementsAre(sf::Keyboard::Key::Right));
+    messageBus_.DispatchQueuedMessages();
+    EXPECT_THAT(keys_, SizeIs(1));
+}
+
+TEST_F(MessageBusTest, DispatchQueuedMessagesShouldDeliverInSentOrder)
+{
+    messageBus_.BeginDeferring();
+    Send(sf::Keyboard::Key::Right);
+    Send(sf::Keyboard::Key::Left);
+    Send(sf::Keyboard::Key::Up);
+    messageBus_.EndDeferring();
+    Send(sf::Keyboard::Key::Down);
+    messageBus_.DispatchQueuedMessages();
+
+    EXPECT_THAT(keys_, ElementsAre(sf::Keyboard::Key::Down, sf::Keyboard::Key::Right, sf::Keyboard::Key::Left,
+                                   sf::Keyboard::Key::Up));
+}
+
+TEST_F(MessageBusTest, MessagesFromOtherThreadsShouldBeDeliveredOnDispatchingThread)
+{
+    messageBus_.BeginDeferring();
+    std::thread t1([this]() { Send(sf::Keyboard::Key::Right); });
+    std::thread t2([this]() { Send(sf::Keyboard::Key::Left); });
+    t1.join();
+    t2.join();
+    Send(sf::Keyboard::Key::Up);
+    messageBus_.EndDeferring();
+
+    EXPECT_THAT(keys_, IsEmpty());
+    messageBus_.DispatchQueuedMessages();
+    EXPECT_THAT(keys_, UnorderedElementsAre(sf::Keyboard::Key::Right, sf::Keyboard::Key::Left, sf::Keyboard::Key::Up));
+    EXPECT_THAT(threadIds_, Each(std::this_thread::get_id()));
+}
+
+}  // namespace Shared
+
+}  // namespace FA
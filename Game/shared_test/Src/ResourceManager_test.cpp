@@ -80,6 +80,16 @@ TEST_F(ResourceManagerTest, LoadResourceShouldFail)
     EXPECT_THAT(result, IsNull());
 }
 
+TEST_F(ResourceManagerTest, AddedResourceShouldBeFoundByName)
+{
+    auto expectedPtr = resourceMock_.get();
+    EXPECT_EQ(resourceManager_.Find("atlas"), InvalidResourceId);
+
+    auto id = resourceManager_.Add("atlas", std::move(resourceMock_));
+    EXPECT_EQ(resourceManager_.Find("atlas"), id);
+    EXPECT_EQ(resourceManager_.Get(id), expectedPtr);
+}
+
 TEST_F(ResourceManagerTest, GetResourceShouldReturnNull)
 {
     EXPECT_CALL(loggerMock_, MakeErrorLogEntry(ContainsRegex("Could not get.*123")));
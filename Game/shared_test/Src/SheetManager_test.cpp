@@ -4,16 +4,22 @@
  *	See file LICENSE for full license details.
  */
 
+#include <memory>
 #include <string>
 
+#include <SFML/Graphics/Image.hpp>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 #include "Mock/LoggerMock.h"
 #include "Mock/SpriteSheetMock.h"
+#include "RenderBackend.h"
 #include "Resource/SheetItem.h"
 #include "Resource/SheetManager.h"
+#include "Resource/TextureManager.h"
 #include "Resource/TextureRect.h"
+#include "Texture.h"
 
 using namespace testing;
 
@@ -55,6 +61,124 @@ TEST_F(SheetManagerTest, MakeRectShouldReturnValidRect)
     EXPECT_THAT(result, Eq(expected));
 }
 
+class SheetManagerAtlasTest : public testing::Test
+{
+protected:
+    SheetManagerAtlasTest()
+        : textureManager_(createFn_.AsStdFunction())
+    {}
+
+    virtual void SetUp() override { Graphic::SetRenderBackend(Graphic::RenderBackend::Null); }
+    virtual void TearDown() override { Graphic::SetRenderBackend(Graphic::RenderBackend::Sfml); }
+
+    void ExpectReadImageSize(const std::string& path, const sf::Vector2u& size)
+    {
+        EXPECT_CALL(readImageSizeFn_, Call(path, _)).WillRepeatedly(DoAll(SetArgReferee<1>(size), Return(true)));
+    }
+
+    void ExpectLoadImage(const std::string& path, const sf::Vector2u& size, int n)
+    {
+        EXPECT_CALL(loadImageFn_, Call(path, _)).Times(n).WillRepeatedly([size](const std::string&, sf::Image& image) {
+            image.create(size.x, size.y, sf::Color::White);
+            return true;
+        });
+    }
+
+    SheetManager MakeSheetManager()
+    {
+        return SheetManager(loadImageFn_.AsStdFunction(), readImageSizeFn_.AsStdFunction());
+    }
+
+    void ExpectCreateTexture(int n)
+    {
+        EXPECT_CALL(createFn_, Call).Times(n).WillRepeatedly([]() { return std::make_unique<Graphic::Texture>(); });
+    }
+
+    const std::string tallPath_ = "C:/MyFolder/tall.png";
+    const std::string widePath_ = "C:/MyFolder/wide.png";
+    StrictMock<LoggerMock> loggerMock_;
+    StrictMock<MockFunction<bool(const std::string&, sf::Image&)>> loadImageFn_;
+    StrictMock<MockFunction<bool(const std::string&, sf::Vector2u&)>> readImageSizeFn_;
+    StrictMock<MockFunction<std::unique_ptr<Graphic::Texture>()>> createFn_;
+    TextureManager textureManager_;
+};
+
+TEST_F(SheetManagerAtlasTest, BuildAtlasShouldPlaceSheetsInOneTexture)
+{
+    ExpectReadImageSize(tallPath_, {16, 32});
+    ExpectReadImageSize(widePath_, {40, 8});
+    ExpectLoadImage(tallPath_, {16, 32}, 1);
+    ExpectLoadImage(widePath_, {40, 8}, 1);
+    ExpectCreateTexture(1);
+    EXPECT_CALL(loggerMock_, MakeInfoLogEntry("Packed 2 sheets in 1 atlas textures"));
+    auto sheetManager = MakeSheetManager();
+    sheetManager.AddImageSheet("wide", widePath_, {4, 1});
+    sheetManager.AddImageSheet("tall", tallPath_, {2, 2});
+
+    sheetManager.BuildAtlas(textureManager_);
+
+    // Highest first, each with 2 pixels of padding: tall at (2, 2) and wide to the right of it at (22, 2)
+    EXPECT_EQ(sheetManager.GetTextureRect({"tall", {0, 0}}), TextureRect(0, {2, 2, 8, 16}));
+    EXPECT_EQ(sheetManager.GetTextureRect({"tall", {1, 1}}), TextureRect(0, {10, 18, 8, 16}));
+    EXPECT_EQ(sheetManager.GetTextureRect({"wide", {0, 0}}), TextureRect(0, {22, 2, 10, 8}));
+    EXPECT_EQ(sheetManager.GetTextureRect({"wide", {3, 0}}), TextureRect(0, {52, 2, 10, 8}));
+    EXPECT_EQ(textureManager_.Get(0)->getSize(), sf::Vector2u(64, 36));
+}
+
+TEST_F(SheetManagerAtlasTest, BuildAtlasWithSameSheetsShouldShareTextureWithoutDecodingAgain)
+{
+    ExpectReadImageSize(tallPath_, {16, 32});
+    ExpectReadImageSize(widePath_, {40, 8});
+    ExpectLoadImage(tallPath_, {16, 32}, 1);
+    ExpectLoadImage(widePath_, {40, 8}, 1);
+    ExpectCreateTexture(1);
+    EXPECT_CALL(loggerMock_, MakeInfoLogEntry("Packed 2 sheets in 1 atlas textures")).Times(2);
+    auto sheetManager1 = MakeSheetManager();
+    auto sheetManager2 = MakeSheetManager();
+    for (auto sheetManager : {&sheetManager1, &sheetManager2}) {
+        sheetManager->AddImageSheet("wide", widePath_, {4, 1});
+        sheetManager->AddImageSheet("tall", tallPath_, {2, 2});
+        sheetManager->BuildAtlas(textureManager_);
+    }
+
+    EXPECT_EQ(sheetManager2.GetTextureRect({"wide", {3, 0}}), sheetManager1.GetTextureRect({"wide", {3, 0}}));
+}
+
+TEST_F(SheetManagerAtlasTest, BuildAtlasWithOtherSheetsShouldNotShareTexture)
+{
+    ExpectReadImageSize(tallPath_, {16, 32});
+    ExpectReadImageSize(widePath_, {40, 8});
+    ExpectLoadImage(tallPath_, {16, 32}, 2);
+    ExpectLoadImage(widePath_, {40, 8}, 1);
+    ExpectCreateTexture(2);
+    EXPECT_CALL(loggerMock_, MakeInfoLogEntry("Packed 2 sheets in 1 atlas textures"));
+    EXPECT_CALL(loggerMock_, MakeInfoLogEntry("Packed 1 sheets in 1 atlas textures"));
+    auto sheetManager1 = MakeSheetManager();
+    sheetManager1.AddImageSheet("wide", widePath_, {4, 1});
+    sheetManager1.AddImageSheet("tall", tallPath_, {2, 2});
+    sheetManager1.BuildAtlas(textureManager_);
+    auto sheetManager2 = MakeSheetManager();
+    sheetManager2.AddImageSheet("tall", tallPath_, {2, 2});
+
+    sheetManager2.BuildAtlas(textureManager_);
+
+    EXPECT_EQ(sheetManager2.GetTextureRect({"tall", {0, 0}}), TextureRect(1, {2, 2, 8, 16}));
+}
+
+TEST_F(SheetManagerAtlasTest, BuildAtlasShouldDecodeImageWhenSizeCanNotBeRead)
+{
+    EXPECT_CALL(readImageSizeFn_, Call(tallPath_, _)).WillOnce(Return(false));
+    ExpectLoadImage(tallPath_, {16, 32}, 1);
+    ExpectCreateTexture(1);
+    EXPECT_CALL(loggerMock_, MakeInfoLogEntry("Packed 1 sheets in 1 atlas textures"));
+    auto sheetManager = MakeSheetManager();
+    sheetManager.AddImageSheet("tall", tallPath_, {2, 2});
+
+    sheetManager.BuildAtlas(textureManager_);
+
+    EXPECT_EQ(sheetManager.GetTextureRect({"tall", {1, 1}}), TextureRect(0, {10, 18, 8, 16}));
+}
+
 }  // namespace Shared
 
 }  // namespace FA
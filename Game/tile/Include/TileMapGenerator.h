@@ -0,0 +1,40 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include "TileMapData.h"
+
+namespace FA {
+
+namespace Tile {
+
+struct GeneratorParams
+{
+    unsigned int width_{};   // in tiles
+    unsigned int height_{};  // in tiles
+    unsigned int nMoles_{};
+    unsigned int nCoins_{};
+    unsigned int nRects_{};
+    float wallDensity_{};  // part of map area covered by Rect objects
+    unsigned int nAnimatedTiles_{};
+    unsigned int seed_ = 1;
+};
+
+bool operator==(const GeneratorParams& lhs, const GeneratorParams& rhs);
+std::ostream& operator<<(std::ostream& os, const GeneratorParams& p);
+
+// Synthetic map for stress testing. Tile sets come from the base map and its static layers are repeated to fill
+// the new size. Mole, Coin and Rect objects and the tiles of animated layers are placed at random positions,
+// other objects (Player, Entrance) keep their base position.
+TileMapData GenerateTileMap(const TileMapData& base, const GeneratorParams& params);
+
+// Params giving scale times the content of the base map, with the same density
+GeneratorParams ScaledParams(const TileMapData& base, unsigned int scale);
+
+}  // namespace Tile
+
+}  // namespace FA
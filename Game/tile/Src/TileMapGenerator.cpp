@@ -0,0 +1,259 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "TileMapGenerator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <ostream>
+#include <random>
+#include <tuple>
+
+namespace FA {
+
+namespace Tile {
+
+namespace {
+
+const std::string moleType = "Mole";
+const std::string coinType = "Coin";
+const std::string rectType = "Rect";
+
+bool IsAnimated(const TileMapData& data, int tileId)
+{
+    auto it = data.tileSets_.lower_bound(tileId);
+    if (it == data.tileSets_.end()) return false;
+
+    const auto& lookupTable = it->second.lookupTable_;
+    auto tileIt = lookupTable.find(tileId - it->first);
+
+    return tileIt != lookupTable.end() && !tileIt->second.animation_.empty();
+}
+
+std::vector<int> AnimatedTileIds(const TileMapData& data, const TileMapData::Layer& layer)
+{
+    std::vector<int> ids;
+    for (auto id : layer.tileIds_) {
+        if (id != 0 && IsAnimated(data, id) && std::find(ids.begin(), ids.end(), id) == ids.end()) {
+            ids.push_back(id);
+        }
+    }
+
+    return ids;
+}
+
+unsigned int CountObjects(const TileMapData& data, const std::string& typeStr)
+{
+    unsigned int n = 0;
+    for (const auto& group : data.objectGroups_) {
+        n += static_cast<unsigned int>(std::count_if(group.objects_.begin(), group.objects_.end(),
+                                                     [&typeStr](const auto& o) { return o.typeStr_ == typeStr; }));
+    }
+
+    return n;
+}
+
+float RectArea(const TileMapData& data)
+{
+    float area = 0.0f;
+    for (const auto& group : data.objectGroups_) {
+        for (const auto& object : group.objects_) {
+            if (object.typeStr_ == rectType) {
+                area += static_cast<float>(object.width_) * static_cast<float>(object.height_);
+            }
+        }
+    }
+
+    return area;
+}
+
+class Generator
+{
+public:
+    Generator(const TileMapData& base, const GeneratorParams& params)
+        : base_(base)
+        , params_(params)
+        , gen_(params.seed_)
+        , mapWidth_(static_cast<float>(params.width_ * base.mapProperties_.tileWidth_))
+        , mapHeight_(static_cast<float>(params.height_ * base.mapProperties_.tileHeight_))
+    {}
+
+    TileMapData Run()
+    {
+        TileMapData data;
+        data.mapProperties_ = base_.mapProperties_;
+        data.mapProperties_.width_ = params_.width_;
+        data.mapProperties_.height_ = params_.height_;
+        data.tileSets_ = base_.tileSets_;
+
+        for (const auto& layer : base_.layers_) {
+            auto animatedIds = AnimatedTileIds(base_, layer);
+            data.layers_.push_back(animatedIds.empty() ? RepeatLayer(layer) : ScatterLayer(layer, animatedIds));
+        }
+
+        nextObjectId_ = 1;
+        for (const auto& group : base_.objectGroups_) {
+            for (const auto& object : group.objects_) {
+                nextObjectId_ = std::max(nextObjectId_, object.id_ + 1);
+            }
+        }
+        for (const auto& group : base_.objectGroups_) {
+            data.objectGroups_.push_back(GenerateGroup(group));
+        }
+
+        return data;
+    }
+
+private:
+    const TileMapData& base_;
+    const GeneratorParams params_;
+    std::mt19937 gen_;
+    float mapWidth_{};
+    float mapHeight_{};
+    int nextObjectId_{};
+
+private:
+    TileMapData::Layer RepeatLayer(const TileMapData::Layer& layer) const
+    {
+        auto baseWidth = base_.mapProperties_.width_;
+        auto baseHeight = base_.mapProperties_.height_;
+        TileMapData::Layer out{layer.name_, std::vector<int>(params_.width_ * params_.height_, 0)};
+        if (baseWidth == 0 || baseHeight == 0 || layer.tileIds_.size() < baseWidth * baseHeight) return out;
+
+        for (unsigned int y = 0; y < params_.height_; y++) {
+            for (unsigned int x = 0; x < params_.width_; x++) {
+                out.tileIds_[y * params_.width_ + x] = layer.tileIds_[(y % baseHeight) * baseWidth + (x % baseWidth)];
+            }
+        }
+
+        return out;
+    }
+
+    TileMapData::Layer ScatterLayer(const TileMapData::Layer& layer, const std::vector<int>& tileIds)
+    {
+        auto nTiles = params_.width_ * params_.height_;
+        TileMapData::Layer out{layer.name_, std::vector<int>(nTiles, 0)};
+        if (nTiles == 0) return out;
+
+        std::uniform_int_distribution<unsigned int> cellDist(0, nTiles - 1);
+        std::uniform_int_distribution<std::size_t> idDist(0, tileIds.size() - 1);
+        auto nAnimatedTiles = std::min(params_.nAnimatedTiles_, nTiles);
+        for (unsigned int i = 0; i < nAnimatedTiles;) {
+            auto& tileId = out.tileIds_[cellDist(gen_)];
+            if (tileId == 0) {
+                tileId = tileIds[idDist(gen_)];
+                i++;
+            }
+        }
+
+        return out;
+    }
+
+    TileMapData::ObjectGroup GenerateGroup(const TileMapData::ObjectGroup& group)
+    {
+        TileMapData::ObjectGroup out{group.name_, {}};
+        for (const auto& object : group.objects_) {
+            if (object.typeStr_ != moleType && object.typeStr_ != coinType && object.typeStr_ != rectType) {
+                out.objects_.push_back(object);
+            }
+        }
+        AddObjects(group, moleType, params_.nMoles_, out);
+        AddObjects(group, coinType, params_.nCoins_, out);
+        AddObjects(group, rectType, params_.nRects_, out);
+
+        return out;
+    }
+
+    // Objects of a type are only generated in the group where the base map has them
+    void AddObjects(const TileMapData::ObjectGroup& group, const std::string& typeStr, unsigned int n,
+                    TileMapData::ObjectGroup& out)
+    {
+        auto it = std::find_if(group.objects_.begin(), group.objects_.end(),
+                               [&typeStr](const auto& o) { return o.typeStr_ == typeStr; });
+        if (it == group.objects_.end()) return;
+
+        const auto& prototype = *it;
+        for (unsigned int i = 0; i < n; i++) {
+            auto object = prototype;
+            object.id_ = nextObjectId_++;
+            if (typeStr == rectType) {
+                SetWallSize(object);
+            }
+            std::uniform_real_distribution<float> xDist(0.0f, std::max(0.0f, mapWidth_ - object.width_));
+            std::uniform_real_distribution<float> yDist(0.0f, std::max(0.0f, mapHeight_ - object.height_));
+            object.x_ = static_cast<int>(xDist(gen_));
+            object.y_ = static_cast<int>(yDist(gen_));
+            out.objects_.push_back(object);
+        }
+    }
+
+    void SetWallSize(TileMapData::Object& object)
+    {
+        float area = params_.wallDensity_ * mapWidth_ * mapHeight_ / static_cast<float>(params_.nRects_);
+        std::uniform_real_distribution<float> aspectDist(0.5f, 2.0f);
+        float aspect = aspectDist(gen_);
+        float width = std::min(std::sqrt(area * aspect), mapWidth_);
+        float height = std::min(std::sqrt(area / aspect), mapHeight_);
+        object.width_ = std::max(1, static_cast<int>(width));
+        object.height_ = std::max(1, static_cast<int>(height));
+    }
+};
+
+}  // namespace
+
+bool operator==(const GeneratorParams& lhs, const GeneratorParams& rhs)
+{
+    return std::tie(lhs.width_, lhs.height_, lhs.nMoles_, lhs.nCoins_, lhs.nRects_, lhs.wallDensity_,
+                    lhs.nAnimatedTiles_, lhs.seed_) == std::tie(rhs.width_, rhs.height_, rhs.nMoles_, rhs.nCoins_,
+                                                                rhs.nRects_, rhs.wallDensity_, rhs.nAnimatedTiles_,
+                                                                rhs.seed_);
+}
+
+std::ostream& operator<<(std::ostream& os, const GeneratorParams& p)
+{
+    os << "width: " << p.width_ << " height: " << p.height_ << " nMoles: " << p.nMoles_ << " nCoins: " << p.nCoins_
+       << " nRects: " << p.nRects_ << " wallDensity: " << p.wallDensity_ << " nAnimatedTiles: " << p.nAnimatedTiles_
+       << " seed: " << p.seed_;
+
+    return os;
+}
+
+TileMapData GenerateTileMap(const TileMapData& base, const GeneratorParams& params)
+{
+    Generator generator(base, params);
+
+    return generator.Run();
+}
+
+GeneratorParams ScaledParams(const TileMapData& base, unsigned int scale)
+{
+    GeneratorParams params;
+    auto sideScale = std::sqrt(static_cast<float>(scale));
+    params.width_ = static_cast<unsigned int>(std::round(base.mapProperties_.width_ * sideScale));
+    params.height_ = static_cast<unsigned int>(std::round(base.mapProperties_.height_ * sideScale));
+    params.nMoles_ = CountObjects(base, moleType) * scale;
+    params.nCoins_ = CountObjects(base, coinType) * scale;
+    params.nRects_ = CountObjects(base, rectType) * scale;
+
+    float mapArea = static_cast<float>(base.mapProperties_.width_ * base.mapProperties_.tileWidth_) *
+                    static_cast<float>(base.mapProperties_.height_ * base.mapProperties_.tileHeight_);
+    params.wallDensity_ = mapArea > 0.0f ? RectArea(base) / mapArea : 0.0f;
+
+    unsigned int nAnimatedTiles = 0;
+    for (const auto& layer : base.layers_) {
+        if (!AnimatedTileIds(base, layer).empty()) {
+            nAnimatedTiles += static_cast<unsigned int>(
+                std::count_if(layer.tileIds_.begin(), layer.tileIds_.end(), [](int id) { return id != 0; }));
+        }
+    }
+    params.nAnimatedTiles_ = nAnimatedTiles * scale;
+
+    return params;
+}
+
+}  // namespace Tile
+
+}  // namespace FA
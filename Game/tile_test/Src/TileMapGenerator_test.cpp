@@ -0,0 +1,120 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include "TileMapGenerator.h"
+
+using namespace testing;
+
+namespace FA {
+
+namespace Tile {
+
+class TileMapGeneratorTest : public Test
+{
+protected:
+    TileMapGeneratorTest()
+    {
+        base_.mapProperties_ = {4, 2, 16, 16};
+        Frame image{"dev/tileset.png", 0, 0, 16, 16};
+        Frame water1{"dev/water1.png", 0, 0, 16, 16};
+        Frame water2{"dev/water2.png", 0, 0, 16, 16};
+        base_.tileSets_[1] = {{{"dev/tileset.png", 2, 1}}, {{0, {image, {}}}, {1, {water1, {water1, water2}}}}};
+        base_.layers_ = {{"Ground", {1, 1, 1, 1, 1, 1, 1, 1}}, {"Dynamic", {0, 2, 0, 0, 0, 0, 0, 0}}};
+        TileMapData::Object player{1, "Player", 10, 10, 0, 0, {{"FaceDirection", "Front"}}};
+        TileMapData::Object mole{2, "Mole", 20, 10, 0, 0, {{"FaceDirection", "Right"}}};
+        TileMapData::Object coin{3, "Coin", 30, 10, 0, 0, {}};
+        TileMapData::Object rect{7, "Rect", 0, 0, 16, 8, {}};
+        base_.objectGroups_ = {{"Objects", {player, mole, coin}}, {"Collision", {rect}}};
+    }
+
+    TileMapData base_;
+
+protected:
+    static unsigned int Count(const TileMapData::ObjectGroup& group, const std::string& typeStr)
+    {
+        return static_cast<unsigned int>(std::count_if(group.objects_.begin(), group.objects_.end(),
+                                                       [&typeStr](const auto& o) { return o.typeStr_ == typeStr; }));
+    }
+};
+
+TEST_F(TileMapGeneratorTest, ScaledParamsShouldScaleContentOfBaseMap)
+{
+    auto params = ScaledParams(base_, 100);
+
+    EXPECT_EQ(40, params.width_);
+    EXPECT_EQ(20, params.height_);
+    EXPECT_EQ(100, params.nMoles_);
+    EXPECT_EQ(100, params.nCoins_);
+    EXPECT_EQ(100, params.nRects_);
+    EXPECT_EQ(100, params.nAnimatedTiles_);
+    EXPECT_FLOAT_EQ(128.0f / 2048.0f, params.wallDensity_);
+}
+
+TEST_F(TileMapGeneratorTest, GenerateShouldRepeatStaticLayerAndScatterAnimatedTiles)
+{
+    GeneratorParams params{8, 6, 0, 0, 0, 0.0f, 5, 1};
+
+    auto data = GenerateTileMap(base_, params);
+
+    EXPECT_EQ(8, data.mapProperties_.width_);
+    EXPECT_EQ(6, data.mapProperties_.height_);
+    EXPECT_EQ(16, data.mapProperties_.tileWidth_);
+    EXPECT_EQ(base_.tileSets_, data.tileSets_);
+    ASSERT_EQ(2, data.layers_.size());
+    EXPECT_EQ("Ground", data.layers_[0].name_);
+    EXPECT_EQ(std::vector<int>(48, 1), data.layers_[0].tileIds_);
+    EXPECT_EQ("Dynamic", data.layers_[1].name_);
+    ASSERT_EQ(48, data.layers_[1].tileIds_.size());
+    EXPECT_EQ(5, std::count(data.layers_[1].tileIds_.begin(), data.layers_[1].tileIds_.end(), 2));
+    EXPECT_EQ(43, std::count(data.layers_[1].tileIds_.begin(), data.layers_[1].tileIds_.end(), 0));
+}
+
+TEST_F(TileMapGeneratorTest, GenerateShouldPlaceObjectsInsideMapWithUniqueIds)
+{
+    GeneratorParams params{8, 6, 20, 30, 10, 0.25f, 0, 1};
+
+    auto data = GenerateTileMap(base_, params);
+
+    ASSERT_EQ(2, data.objectGroups_.size());
+    const auto& objects = data.objectGroups_[0];
+    const auto& collision = data.objectGroups_[1];
+    EXPECT_EQ(1, Count(objects, "Player"));
+    EXPECT_EQ(20, Count(objects, "Mole"));
+    EXPECT_EQ(30, Count(objects, "Coin"));
+    EXPECT_EQ(0, Count(objects, "Rect"));
+    EXPECT_EQ(10, Count(collision, "Rect"));
+
+    std::vector<int> ids;
+    for (const auto& group : data.objectGroups_) {
+        for (const auto& object : group.objects_) {
+            ids.push_back(object.id_);
+            EXPECT_GE(object.x_, 0);
+            EXPECT_GE(object.y_, 0);
+            EXPECT_LE(object.x_ + object.width_, 8 * 16);
+            EXPECT_LE(object.y_ + object.height_, 6 * 16);
+            if (object.typeStr_ == "Mole") {
+                EXPECT_EQ("Right", object.properties_.at("FaceDirection"));
+            }
+        }
+    }
+    std::sort(ids.begin(), ids.end());
+    EXPECT_TRUE(std::adjacent_find(ids.begin(), ids.end()) == ids.end());
+}
+
+TEST_F(TileMapGeneratorTest, GenerateShouldBeDeterministicForSameSeed)
+{
+    GeneratorParams params{8, 6, 5, 5, 5, 0.1f, 5, 42};
+
+    EXPECT_EQ(GenerateTileMap(base_, params), GenerateTileMap(base_, params));
+}
+
+}  // namespace Tile
+
+}  // namespace FA
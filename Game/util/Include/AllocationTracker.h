@@ -0,0 +1,53 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <iosfwd>
+
+namespace FA {
+
+namespace Util {
+
+struct AllocationStats
+{
+    std::size_t nAllocations_{};
+    std::size_t nBytes_{};
+};
+
+bool operator==(const AllocationStats& lhs, const AllocationStats& rhs);
+AllocationStats operator-(const AllocationStats& lhs, const AllocationStats& rhs);
+std::ostream& operator<<(std::ostream& os, const AllocationStats& p);
+
+// Counts calls to global operator new while enabled. Counters are per thread, so the cost is a flag check and two
+// increments. Define FA_ALLOCATION_TRACKING_DISABLED to keep the default operator new.
+void EnableAllocationTracking(bool enable);
+bool IsAllocationTrackingEnabled();
+AllocationStats GetThreadAllocationStats();  // accumulated for the calling thread
+
+// Called once per frame by the game loop thread. The frame stats include allocations made on that thread and the ones
+// added with AddFrameAllocations, e.g. by JobSystem workers.
+void EndAllocationFrame();
+AllocationStats GetFrameAllocationStats();  // last completed frame
+void AddFrameAllocations(const AllocationStats& stats);  // from any thread
+
+class ScopedAllocationCount
+{
+public:
+    ScopedAllocationCount()
+        : start_(GetThreadAllocationStats())
+    {}
+
+    AllocationStats Get() const { return GetThreadAllocationStats() - start_; }
+
+private:
+    AllocationStats start_;
+};
+
+}  // namespace Util
+
+}  // namespace FA
@@ -0,0 +1,76 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace FA {
+
+namespace Util {
+
+// Nearest rank p95 and p99 of fewer samples than these are the max, so they are left at 0, not written and not
+// compared
+constexpr std::size_t minSamplesP95 = 20;
+constexpr std::size_t minSamplesP99 = 100;
+
+struct Percentiles
+{
+    double p50_{};
+    double p95_{};
+    double p99_{};
+    double max_{};
+    std::size_t count_{};  // number of samples
+
+    bool HasP95() const { return count_ >= minSamplesP95; }
+    bool HasP99() const { return count_ >= minSamplesP99; }
+};
+
+bool operator==(const Percentiles& lhs, const Percentiles& rhs);
+std::ostream& operator<<(std::ostream& os, const Percentiles& p);
+
+// Per phase percentiles of frame times in milliseconds, e.g. "Frame", "Update", "Draw"
+using FrameMetrics = std::map<std::string, Percentiles>;
+
+struct Regression
+{
+    std::string phase_;
+    std::string metric_;  // p50, p95, p99 or max
+    double baseline_{};
+    double value_{};
+};
+
+class FrameTimings
+{
+public:
+    void Add(const std::string& phase, double ms) { samples_[phase].push_back(ms); }
+    std::size_t Count(const std::string& phase) const;
+    FrameMetrics Compute() const;
+
+private:
+    std::map<std::string, std::vector<double>> samples_;
+};
+
+// Nearest rank percentiles
+Percentiles ComputePercentiles(std::vector<double> samples);
+
+bool WriteFrameMetrics(std::ostream& os, const FrameMetrics& metrics);
+bool ReadFrameMetrics(std::istream& is, FrameMetrics& metrics);  // only reads the json written above
+
+// A metric regresses when it is more than tolerance (0.1 is 10%) above baseline. p50 is always compared, p95 and p99
+// only when both have enough samples, and max not at all since one outlier sets it. Phases missing in baseline are
+// not compared, get them with MissingInBaseline to report them.
+std::vector<Regression> CompareFrameMetrics(const FrameMetrics& baseline, const FrameMetrics& current,
+                                            double tolerance);
+std::vector<std::string> MissingInBaseline(const FrameMetrics& baseline, const FrameMetrics& current);
+
+}  // namespace Util
+
+}  // namespace FA
@@ -0,0 +1,48 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+namespace FA {
+
+namespace Util {
+
+// Input of a game session, frame by frame, so that it can be replayed with the same result
+struct InputRecording
+{
+    enum class EventType : std::uint8_t { KeyPressed, KeyReleased, Closed, LostFocus };
+
+    struct Event
+    {
+        EventType type_{};
+        int key_{};  // sf::Keyboard::Key, only used by key events
+    };
+
+    struct Frame
+    {
+        float deltaTime_{};
+        std::vector<Event> events_;
+    };
+
+    unsigned int seed_{};
+    std::vector<Frame> frames_;
+};
+
+bool operator==(const InputRecording::Event& lhs, const InputRecording::Event& rhs);
+bool operator==(const InputRecording::Frame& lhs, const InputRecording::Frame& rhs);
+bool operator==(const InputRecording& lhs, const InputRecording& rhs);
+
+// Little endian binary format. The frame index is the timestamp of an event.
+bool WriteInputRecording(std::ostream& os, const InputRecording& recording);
+bool ReadInputRecording(std::istream& is, InputRecording& recording);
+
+}  // namespace Util
+
+}  // namespace FA
@@ -0,0 +1,83 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace FA {
+
+namespace Util {
+
+// Thread pool where each worker has its own job queue. A worker runs its newest job first and, when its queue is
+// empty, steals the oldest job of another worker. Jobs started from a thread that is not a worker are spread over the
+// workers round robin. Until Start is called there are no workers and jobs run directly in the calling thread.
+// Jobs must not throw.
+class JobSystem
+{
+public:
+    using Job = std::function<void()>;
+
+    // Number of jobs started with the counter that are not finished
+    class Counter
+    {
+    public:
+        bool IsDone() const { return n_.load(std::memory_order_acquire) == 0; }
+
+    private:
+        friend class JobSystem;
+        std::atomic<unsigned int> n_{0};
+    };
+
+    static JobSystem& Instance();
+    static unsigned int DefaultWorkerCount();  // hardware threads except the calling one
+
+    JobSystem();
+    ~JobSystem();
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    void Start(unsigned int nWorkers);
+    void Stop();  // queued jobs are run before the workers exit
+    unsigned int GetWorkerCount() const { return static_cast<unsigned int>(workers_.size()); }
+
+    void Run(Job job, Counter& counter);
+    // Runs queued jobs in the calling thread until all jobs of the counter are finished
+    void Wait(const Counter& counter);
+    // Calls fn(begin, end) for ranges of at most grainSize indices covering [0, n), returns when all are done
+    void ParallelFor(std::size_t n, std::size_t grainSize, const std::function<void(std::size_t, std::size_t)>& fn);
+
+private:
+    struct Entry
+    {
+        Job job_;
+        Counter* counter_ = nullptr;
+    };
+
+    struct Worker;
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::atomic<bool> running_{false};
+    std::atomic<unsigned int> nQueued_{0};
+    std::atomic<unsigned int> nextWorker_{0};
+    std::mutex sleepMutex_;
+    std::condition_variable wakeUp_;
+
+private:
+    void WorkerLoop(unsigned int index);
+    bool TryRunJob();
+    bool TryPop(unsigned int index, bool newest, Entry& entry);
+};
+
+}  // namespace Util
+
+}  // namespace FA
@@ -8,8 +8,13 @@
 
 #include "LoggerIf.h"
 
+#include <atomic>
+#include <condition_variable>
 #include <fstream>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 
 namespace FA {
 
@@ -17,6 +22,12 @@ namespace Util {
 
 enum class LogLevel;
 class Entry;
+template <class T, std::size_t Capacity>
+class RingBuffer;
+
+// Entries are queued by the caller and written to file in batches by a background thread.
+// When the queue is full the entry is dropped and counted. Without a running writer thread,
+// before OpenLog or when the file could not be opened, entries are written by the caller.
 
 class Logger : public LoggerIf
 {
@@ -32,8 +43,20 @@ public:
     virtual void MakeInfoLogEntry(const std::string& fn, const std::string& str) override;
     virtual void MakeWarnLogEntry(const std::string& fn, const std::string& str) override;
     virtual void MakeErrorLogEntry(const std::string& fn, const std::string& str) override;
+    unsigned int GetDroppedCount() const { return nDropped_; }
 
 private:
+    static constexpr std::size_t queueCapacity_ = 4096;
+    using Queue = RingBuffer<std::string, queueCapacity_>;
+
+    std::unique_ptr<Queue> queue_;
+    std::thread writer_;
+    std::atomic<bool> running_{false};
+    std::atomic<unsigned int> nDropped_{0};
+    std::atomic<unsigned int> nPushing_{0};
+    std::mutex writeMutex_;
+    std::mutex wakeMutex_;
+    std::condition_variable wakeCond_;
     std::ofstream logStream_;
     std::string filePath_;
     std::ofstream::pos_type currSize_;
@@ -41,9 +64,12 @@ private:
     bool toConsole_{false};
 
 private:
-    void LogStr(const std::string& logStr);
+    void LogStr(std::string&& logStr);
     void LogEntry(const Entry& entry);
-    void EndLine();
+    void WriterLoop();
+    void Drain();
+    // Called with writeMutex_ held, virtual so tests can record what is written and stall the writer thread
+    virtual void WriteStr(const std::string& logStr);
     void OpeningLines();
     void ClosingLines();
     std::string TimeStr();
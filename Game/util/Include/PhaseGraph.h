@@ -0,0 +1,55 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace FA {
+
+namespace Util {
+
+class JobSystem;
+
+// Systems of a frame with the resources they read and write. A phase waits for the earlier added phases it conflicts
+// with, that is when they access the same resource and at least one of them writes it. Other phases may run
+// concurrently.
+class PhaseGraph
+{
+public:
+    using Fn = std::function<void()>;
+
+    // name must be a string literal, it is used as profile zone
+    void AddPhase(const char* name, const std::vector<std::string>& reads, const std::vector<std::string>& writes,
+                  Fn fn);
+    // Without workers the phases run depth first, successors of a phase run before the next independent phase
+    void Run(JobSystem& jobSystem) const;
+    void Clear() { phases_.clear(); }
+
+    std::size_t GetPhaseCount() const { return phases_.size(); }
+    const char* GetName(std::size_t phase) const { return phases_.at(phase).name_; }
+    const std::vector<std::size_t>& GetDependencies(std::size_t phase) const { return phases_.at(phase).dependencies_; }
+
+private:
+    struct Phase
+    {
+        const char* name_ = nullptr;
+        std::vector<std::string> reads_;
+        std::vector<std::string> writes_;
+        Fn fn_;
+        std::vector<std::size_t> dependencies_;  // earlier phases that must be done first
+        std::vector<std::size_t> successors_;    // later phases that depend on this
+    };
+
+    std::vector<Phase> phases_;
+};
+
+}  // namespace Util
+
+}  // namespace FA
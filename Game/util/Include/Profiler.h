@@ -0,0 +1,120 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "AllocationTracker.h"
+
+namespace FA {
+
+namespace Util {
+
+// Collects timed zones in one ring buffer per thread. Oldest events are overwritten when a buffer is full.
+// Read events (GetEvents, export) when the profiler is disabled or the zones are done, since writers are not
+// synchronized with readers.
+class Profiler
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Event
+    {
+        const char* name_ = nullptr;  // must be a string literal
+        Clock::time_point start_;
+        Clock::time_point end_;
+        AllocationStats allocations_;  // including nested zones, only when allocation tracking is enabled
+    };
+
+    struct ThreadEvents
+    {
+        unsigned int threadId_{};
+        std::string threadName_;
+        std::vector<Event> events_;
+    };
+
+    static constexpr std::size_t eventCapacity = 1 << 18;  // per thread
+
+    static Profiler& Instance();
+
+    Profiler();
+    ~Profiler();
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    void Enable(bool enable) { enabled_.store(enable, std::memory_order_relaxed); }
+    bool IsEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+    void SetThreadName(const std::string& name);
+    void AddEvent(const char* name, Clock::time_point start, Clock::time_point end,
+                  const AllocationStats& allocations = AllocationStats());
+    std::vector<ThreadEvents> GetEvents() const;
+    void Clear();
+    void WriteChromeTrace(std::ostream& os) const;
+    bool ExportChromeTrace(const std::string& filePath) const;
+
+private:
+    struct ThreadBuffer;
+
+    unsigned int id_{};
+    std::atomic<bool> enabled_{false};
+    Clock::time_point epoch_;
+    mutable std::mutex mutex_;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers_;
+
+private:
+    ThreadBuffer& GetThreadBuffer();
+};
+
+class ProfileZone
+{
+public:
+    explicit ProfileZone(const char* name)
+        : name_(name)
+    {
+        if (Profiler::Instance().IsEnabled()) {
+            active_ = true;
+            allocationStart_ = GetThreadAllocationStats();
+            start_ = Profiler::Clock::now();
+        }
+    }
+
+    ~ProfileZone()
+    {
+        if (active_) {
+            auto end = Profiler::Clock::now();
+            Profiler::Instance().AddEvent(name_, start_, end, GetThreadAllocationStats() - allocationStart_);
+        }
+    }
+
+    ProfileZone(const ProfileZone&) = delete;
+    ProfileZone& operator=(const ProfileZone&) = delete;
+
+private:
+    const char* name_ = nullptr;
+    bool active_ = false;
+    Profiler::Clock::time_point start_;
+    AllocationStats allocationStart_;
+};
+
+}  // namespace Util
+
+}  // namespace FA
+
+#define PROFILE_CONCAT_DETAIL(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_DETAIL(a, b)
+
+#ifdef FA_PROFILER_DISABLED
+#define PROFILE_ZONE(name) ((void)0)
+#else
+#define PROFILE_ZONE(name) FA::Util::ProfileZone PROFILE_CONCAT(profileZone, __LINE__)(name)
+#endif  // FA_PROFILER_DISABLED
@@ -11,6 +11,7 @@ namespace FA {
 namespace Util {
 
 int RandomizeRange(int min, int max);
+void SetRandomSeed(unsigned int seed);  // default seed is the start time
 
 }  // namespace Util
 
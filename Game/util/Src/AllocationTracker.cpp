@@ -0,0 +1,155 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "AllocationTracker.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <ostream>
+#include <tuple>
+
+namespace FA {
+
+namespace Util {
+
+namespace {
+
+std::atomic<bool> enabled{false};
+thread_local AllocationStats threadStats;
+AllocationStats frameStart;
+AllocationStats frameStats;
+std::atomic<std::size_t> nOtherAllocations{0};
+std::atomic<std::size_t> nOtherBytes{0};
+
+}  // namespace
+
+bool operator==(const AllocationStats& lhs, const AllocationStats& rhs)
+{
+    return std::tie(lhs.nAllocations_, lhs.nBytes_) == std::tie(rhs.nAllocations_, rhs.nBytes_);
+}
+
+AllocationStats operator-(const AllocationStats& lhs, const AllocationStats& rhs)
+{
+    return {lhs.nAllocations_ - rhs.nAllocations_, lhs.nBytes_ - rhs.nBytes_};
+}
+
+std::ostream& operator<<(std::ostream& os, const AllocationStats& p)
+{
+    os << "nAllocations: " << p.nAllocations_ << " nBytes: " << p.nBytes_;
+
+    return os;
+}
+
+void EnableAllocationTracking(bool enable)
+{
+    enabled.store(enable, std::memory_order_relaxed);
+}
+
+bool IsAllocationTrackingEnabled()
+{
+    return enabled.load(std::memory_order_relaxed);
+}
+
+AllocationStats GetThreadAllocationStats()
+{
+    return threadStats;
+}
+
+void EndAllocationFrame()
+{
+    auto stats = GetThreadAllocationStats();
+    frameStats = stats - frameStart;
+    frameStats.nAllocations_ += nOtherAllocations.exchange(0, std::memory_order_relaxed);
+    frameStats.nBytes_ += nOtherBytes.exchange(0, std::memory_order_relaxed);
+    frameStart = stats;
+}
+
+AllocationStats GetFrameAllocationStats()
+{
+    return frameStats;
+}
+
+void AddFrameAllocations(const AllocationStats& stats)
+{
+    nOtherAllocations.fetch_add(stats.nAllocations_, std::memory_order_relaxed);
+    nOtherBytes.fetch_add(stats.nBytes_, std::memory_order_relaxed);
+}
+
+}  // namespace Util
+
+}  // namespace FA
+
+#ifndef FA_ALLOCATION_TRACKING_DISABLED
+
+// The replacements are linked in together with the functions above, i.e. in every executable using the tracker
+namespace {
+
+void* Allocate(std::size_t size)
+{
+    if (FA::Util::enabled.load(std::memory_order_relaxed)) {
+        FA::Util::threadStats.nAllocations_++;
+        FA::Util::threadStats.nBytes_ += size;
+    }
+
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+}  // namespace
+
+void* operator new(std::size_t size)
+{
+    if (void* p = Allocate(size)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    if (void* p = Allocate(size)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return Allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return Allocate(size);
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, const std::nothrow_t&) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, const std::nothrow_t&) noexcept
+{
+    std::free(p);
+}
+
+#endif  // FA_ALLOCATION_TRACKING_DISABLED
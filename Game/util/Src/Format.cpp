@@ -6,11 +6,16 @@
 
 #include "Format.h"
 
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
 namespace FA {
 
 namespace Util {
 
 static constexpr int maxLogEntrySize{40000};  // arbitrary number
+static constexpr int stackBufferSize{256};
 
 std::string ToString(const char* format, ...)
 {
@@ -19,10 +24,20 @@ std::string ToString(const char* format, ...)
     if (format != nullptr) {
         va_list args;
         va_start(args, format);
-        char buffer[maxLogEntrySize + 1];
-        memset(buffer, 0, maxLogEntrySize * sizeof(char));
-        vsnprintf(buffer, sizeof(buffer), format, args);
-        result = std::string(buffer);
+        va_list argsCopy;
+        va_copy(argsCopy, args);
+        // Most entries are short, only go to the heap when they don't fit
+        char buffer[stackBufferSize];
+        int size = vsnprintf(buffer, sizeof(buffer), format, args);
+        if (size >= 0 && size < stackBufferSize) {
+            result.assign(buffer, size);
+        }
+        else if (size > 0) {
+            std::vector<char> largeBuffer(std::min(size, maxLogEntrySize) + 1);
+            vsnprintf(largeBuffer.data(), largeBuffer.size(), format, argsCopy);
+            result.assign(largeBuffer.data(), largeBuffer.size() - 1);
+        }
+        va_end(argsCopy);
         va_end(args);
     }
 
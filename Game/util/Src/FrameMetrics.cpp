@@ -0,0 +1,228 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "FrameMetrics.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <istream>
+#include <iterator>
+#include <ostream>
+#include <tuple>
+
+namespace FA {
+
+namespace Util {
+
+namespace {
+
+double Rank(const std::vector<double>& sorted, double percentile)
+{
+    auto rank = static_cast<std::size_t>(std::ceil(percentile / 100.0 * sorted.size()));
+    return sorted[std::max<std::size_t>(rank, 1) - 1];
+}
+
+class Parser
+{
+public:
+    Parser(std::istream& is)
+        : str_(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>())
+    {}
+
+    bool Parse(FrameMetrics& metrics)
+    {
+        if (!Accept('{')) return false;
+        if (Peek('}')) return Accept('}');
+
+        do {
+            std::string phase;
+            Percentiles percentiles;
+            if (!ParseString(phase) || !Accept(':') || !ParsePercentiles(percentiles)) return false;
+            metrics[phase] = percentiles;
+        } while (Accept(','));
+
+        return Accept('}');
+    }
+
+private:
+    std::string str_;
+    std::size_t pos_{};
+
+private:
+    void SkipSpace()
+    {
+        while (pos_ < str_.size() && std::isspace(static_cast<unsigned char>(str_[pos_]))) pos_++;
+    }
+
+    bool Peek(char c)
+    {
+        SkipSpace();
+        return pos_ < str_.size() && str_[pos_] == c;
+    }
+
+    bool Accept(char c)
+    {
+        if (!Peek(c)) return false;
+        pos_++;
+        return true;
+    }
+
+    bool ParseString(std::string& str)
+    {
+        if (!Accept('"')) return false;
+        auto end = str_.find('"', pos_);
+        if (end == std::string::npos) return false;
+        str = str_.substr(pos_, end - pos_);
+        pos_ = end + 1;
+
+        return true;
+    }
+
+    bool ParseNumber(double& value)
+    {
+        SkipSpace();
+        const char* begin = str_.c_str() + pos_;
+        char* end = nullptr;
+        value = std::strtod(begin, &end);
+        if (end == begin) return false;
+        pos_ += end - begin;
+
+        return true;
+    }
+
+    bool ParsePercentiles(Percentiles& percentiles)
+    {
+        if (!Accept('{')) return false;
+
+        do {
+            std::string name;
+            double value = 0.0;
+            if (!ParseString(name) || !Accept(':') || !ParseNumber(value)) return false;
+            if (name == "p50") percentiles.p50_ = value;
+            else if (name == "p95") percentiles.p95_ = value;
+            else if (name == "p99") percentiles.p99_ = value;
+            else if (name == "max") percentiles.max_ = value;
+            else if (name == "count") percentiles.count_ = static_cast<std::size_t>(value);
+        } while (Accept(','));
+
+        return Accept('}');
+    }
+};
+
+void Compare(const std::string& phase, const std::string& metric, double baseline, double value, double tolerance,
+             std::vector<Regression>& regressions)
+{
+    if (value > baseline * (1.0 + tolerance)) {
+        regressions.push_back({phase, metric, baseline, value});
+    }
+}
+
+}  // namespace
+
+bool operator==(const Percentiles& lhs, const Percentiles& rhs)
+{
+    return std::tie(lhs.p50_, lhs.p95_, lhs.p99_, lhs.max_, lhs.count_) ==
+           std::tie(rhs.p50_, rhs.p95_, rhs.p99_, rhs.max_, rhs.count_);
+}
+
+std::ostream& operator<<(std::ostream& os, const Percentiles& p)
+{
+    os << "p50: " << p.p50_;
+    if (p.HasP95()) os << " p95: " << p.p95_;
+    if (p.HasP99()) os << " p99: " << p.p99_;
+    os << " max: " << p.max_ << " count: " << p.count_;
+
+    return os;
+}
+
+std::size_t FrameTimings::Count(const std::string& phase) const
+{
+    auto it = samples_.find(phase);
+    return it != samples_.end() ? it->second.size() : 0;
+}
+
+FrameMetrics FrameTimings::Compute() const
+{
+    FrameMetrics metrics;
+    for (const auto& entry : samples_) {
+        metrics[entry.first] = ComputePercentiles(entry.second);
+    }
+
+    return metrics;
+}
+
+Percentiles ComputePercentiles(std::vector<double> samples)
+{
+    if (samples.empty()) return {};
+
+    std::sort(samples.begin(), samples.end());
+    Percentiles percentiles{Rank(samples, 50.0), 0.0, 0.0, samples.back(), samples.size()};
+    if (percentiles.HasP95()) percentiles.p95_ = Rank(samples, 95.0);
+    if (percentiles.HasP99()) percentiles.p99_ = Rank(samples, 99.0);
+
+    return percentiles;
+}
+
+bool WriteFrameMetrics(std::ostream& os, const FrameMetrics& metrics)
+{
+    os << "{";
+    std::string separator = "\n";
+    for (const auto& entry : metrics) {
+        const auto& p = entry.second;
+        os << separator << "  \"" << entry.first << "\": {\"p50\": " << p.p50_;
+        if (p.HasP95()) os << ", \"p95\": " << p.p95_;
+        if (p.HasP99()) os << ", \"p99\": " << p.p99_;
+        os << ", \"max\": " << p.max_ << ", \"count\": " << p.count_ << "}";
+        separator = ",\n";
+    }
+    os << "\n}\n";
+
+    return static_cast<bool>(os);
+}
+
+bool ReadFrameMetrics(std::istream& is, FrameMetrics& metrics)
+{
+    FrameMetrics result;
+    Parser parser(is);
+    if (!parser.Parse(result)) return false;
+    metrics = result;
+
+    return true;
+}
+
+std::vector<Regression> CompareFrameMetrics(const FrameMetrics& baseline, const FrameMetrics& current,
+                                            double tolerance)
+{
+    std::vector<Regression> regressions;
+    for (const auto& entry : current) {
+        auto it = baseline.find(entry.first);
+        if (it == baseline.end()) continue;
+
+        const auto& b = it->second;
+        const auto& c = entry.second;
+        Compare(entry.first, "p50", b.p50_, c.p50_, tolerance, regressions);
+        if (b.HasP95() && c.HasP95()) Compare(entry.first, "p95", b.p95_, c.p95_, tolerance, regressions);
+        if (b.HasP99() && c.HasP99()) Compare(entry.first, "p99", b.p99_, c.p99_, tolerance, regressions);
+    }
+
+    return regressions;
+}
+
+std::vector<std::string> MissingInBaseline(const FrameMetrics& baseline, const FrameMetrics& current)
+{
+    std::vector<std::string> missing;
+    for (const auto& entry : current) {
+        if (baseline.find(entry.first) == baseline.end()) missing.push_back(entry.first);
+    }
+
+    return missing;
+}
+
+}  // namespace Util
+
+}  // namespace FA
@@ -0,0 +1,144 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "InputRecording.h"
+
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <tuple>
+
+namespace FA {
+
+namespace Util {
+
+namespace {
+
+const char magic[4] = {'F', 'A', 'I', 'R'};
+const std::uint32_t version = 1;
+
+void WriteU32(std::ostream& os, std::uint32_t value)
+{
+    char bytes[4];
+    for (int i = 0; i < 4; i++) {
+        bytes[i] = static_cast<char>((value >> (8 * i)) & 0xff);
+    }
+    os.write(bytes, sizeof(bytes));
+}
+
+bool ReadU32(std::istream& is, std::uint32_t& value)
+{
+    unsigned char bytes[4];
+    if (!is.read(reinterpret_cast<char*>(bytes), sizeof(bytes))) return false;
+
+    value = 0;
+    for (int i = 0; i < 4; i++) {
+        value |= static_cast<std::uint32_t>(bytes[i]) << (8 * i);
+    }
+
+    return true;
+}
+
+void WriteFloat(std::ostream& os, float value)
+{
+    static_assert(sizeof(float) == sizeof(std::uint32_t), "Unexpected float size");
+    std::uint32_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    WriteU32(os, bits);
+}
+
+bool ReadFloat(std::istream& is, float& value)
+{
+    std::uint32_t bits = 0;
+    if (!ReadU32(is, bits)) return false;
+    std::memcpy(&value, &bits, sizeof(value));
+
+    return true;
+}
+
+// Event is packed as type in the lowest byte and key in the upper bytes
+std::uint32_t Pack(const InputRecording::Event& event)
+{
+    return static_cast<std::uint32_t>(event.type_) | (static_cast<std::uint32_t>(event.key_ + 1) << 8);
+}
+
+bool Unpack(std::uint32_t value, InputRecording::Event& event)
+{
+    auto type = value & 0xff;
+    if (type > static_cast<std::uint32_t>(InputRecording::EventType::LostFocus)) return false;
+    event.type_ = static_cast<InputRecording::EventType>(type);
+    event.key_ = static_cast<int>(value >> 8) - 1;  // sf::Keyboard::Unknown is -1
+
+    return true;
+}
+
+}  // namespace
+
+bool operator==(const InputRecording::Event& lhs, const InputRecording::Event& rhs)
+{
+    return std::tie(lhs.type_, lhs.key_) == std::tie(rhs.type_, rhs.key_);
+}
+
+bool operator==(const InputRecording::Frame& lhs, const InputRecording::Frame& rhs)
+{
+    return std::tie(lhs.deltaTime_, lhs.events_) == std::tie(rhs.deltaTime_, rhs.events_);
+}
+
+bool operator==(const InputRecording& lhs, const InputRecording& rhs)
+{
+    return std::tie(lhs.seed_, lhs.frames_) == std::tie(rhs.seed_, rhs.frames_);
+}
+
+bool WriteInputRecording(std::ostream& os, const InputRecording& recording)
+{
+    os.write(magic, sizeof(magic));
+    WriteU32(os, version);
+    WriteU32(os, recording.seed_);
+    WriteU32(os, static_cast<std::uint32_t>(recording.frames_.size()));
+    for (const auto& frame : recording.frames_) {
+        WriteFloat(os, frame.deltaTime_);
+        WriteU32(os, static_cast<std::uint32_t>(frame.events_.size()));
+        for (const auto& event : frame.events_) {
+            WriteU32(os, Pack(event));
+        }
+    }
+
+    return static_cast<bool>(os);
+}
+
+bool ReadInputRecording(std::istream& is, InputRecording& recording)
+{
+    char fileMagic[sizeof(magic)];
+    if (!is.read(fileMagic, sizeof(fileMagic)) || std::memcmp(fileMagic, magic, sizeof(magic)) != 0) return false;
+
+    std::uint32_t fileVersion = 0;
+    if (!ReadU32(is, fileVersion) || fileVersion != version) return false;
+
+    InputRecording result;
+    std::uint32_t nFrames = 0;
+    if (!ReadU32(is, result.seed_) || !ReadU32(is, nFrames)) return false;
+
+    for (std::uint32_t i = 0; i < nFrames; i++) {
+        InputRecording::Frame frame;
+        std::uint32_t nEvents = 0;
+        if (!ReadFloat(is, frame.deltaTime_) || !ReadU32(is, nEvents)) return false;
+        for (std::uint32_t j = 0; j < nEvents; j++) {
+            std::uint32_t value = 0;
+            InputRecording::Event event;
+            if (!ReadU32(is, value) || !Unpack(value, event)) return false;
+            frame.events_.push_back(event);
+        }
+        result.frames_.push_back(std::move(frame));
+    }
+
+    recording = std::move(result);
+
+    return true;
+}
+
+}  // namespace Util
+
+}  // namespace FA
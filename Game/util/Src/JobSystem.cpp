@@ -0,0 +1,191 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "JobSystem.h"
+
+#include <algorithm>
+#include <deque>
+#include <string>
+#include <thread>
+
+#include "AllocationTracker.h"
+#include "Profiler.h"
+
+namespace FA {
+
+namespace Util {
+
+namespace {
+
+thread_local const JobSystem* currentSystem = nullptr;
+thread_local unsigned int currentWorker = 0;
+
+}  // namespace
+
+struct JobSystem::Worker
+{
+    std::mutex mutex_;
+    std::deque<Entry> jobs_;
+    std::thread thread_;
+};
+
+JobSystem& JobSystem::Instance()
+{
+    static JobSystem jobSystem;
+    return jobSystem;
+}
+
+unsigned int JobSystem::DefaultWorkerCount()
+{
+    auto nThreads = std::thread::hardware_concurrency();
+    return nThreads > 1 ? nThreads - 1 : 0;
+}
+
+JobSystem::JobSystem() = default;
+
+JobSystem::~JobSystem()
+{
+    Stop();
+}
+
+void JobSystem::Start(unsigned int nWorkers)
+{
+    Stop();
+    for (unsigned int i = 0; i < nWorkers; i++) {
+        workers_.push_back(std::make_unique<Worker>());
+    }
+    running_ = true;
+    for (unsigned int i = 0; i < nWorkers; i++) {
+        workers_[i]->thread_ = std::thread([this, i]() { WorkerLoop(i); });
+    }
+}
+
+void JobSystem::Stop()
+{
+    if (workers_.empty()) return;
+
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex_);
+        running_ = false;
+    }
+    wakeUp_.notify_all();
+    for (auto& worker : workers_) {
+        worker->thread_.join();
+    }
+    workers_.clear();
+}
+
+void JobSystem::Run(Job job, Counter& counter)
+{
+    if (workers_.empty()) {
+        job();
+        return;
+    }
+
+    counter.n_.fetch_add(1, std::memory_order_relaxed);
+    auto index = currentSystem == this ? currentWorker : nextWorker_++ % GetWorkerCount();
+    {
+        auto& worker = *workers_[index];
+        std::lock_guard<std::mutex> lock(worker.mutex_);
+        worker.jobs_.push_back({std::move(job), &counter});
+        nQueued_++;
+    }
+    {
+        // A worker checks nQueued_ with the mutex held before it sleeps, so it can't miss this notify
+        std::lock_guard<std::mutex> lock(sleepMutex_);
+    }
+    wakeUp_.notify_one();
+}
+
+void JobSystem::Wait(const Counter& counter)
+{
+    while (!counter.IsDone()) {
+        if (!TryRunJob()) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void JobSystem::ParallelFor(std::size_t n, std::size_t grainSize,
+                            const std::function<void(std::size_t, std::size_t)>& fn)
+{
+    grainSize = std::max<std::size_t>(grainSize, 1);
+    Counter counter;
+    for (std::size_t begin = 0; begin < n; begin += grainSize) {
+        auto end = std::min(n, begin + grainSize);
+        Run([&fn, begin, end]() { fn(begin, end); }, counter);
+    }
+    Wait(counter);
+}
+
+void JobSystem::WorkerLoop(unsigned int index)
+{
+    currentSystem = this;
+    currentWorker = index;
+    Profiler::Instance().SetThreadName("Worker " + std::to_string(index));
+
+    while (true) {
+        if (TryRunJob()) continue;
+
+        std::unique_lock<std::mutex> lock(sleepMutex_);
+        wakeUp_.wait(lock, [this]() { return nQueued_ > 0 || !running_; });
+        if (!running_ && nQueued_ == 0) break;
+    }
+
+    currentSystem = nullptr;
+}
+
+bool JobSystem::TryRunJob()
+{
+    if (workers_.empty()) return false;
+
+    Entry entry;
+    bool isWorker = currentSystem == this;
+    auto nWorkers = GetWorkerCount();
+    auto first = isWorker ? currentWorker : nextWorker_.load() % nWorkers;
+    bool found = isWorker && TryPop(first, true, entry);
+    for (unsigned int i = isWorker ? 1 : 0; !found && i < nWorkers; i++) {
+        found = TryPop((first + i) % nWorkers, false, entry);
+    }
+    if (!found) return false;
+
+    if (isWorker && IsAllocationTrackingEnabled()) {
+        // Worker allocations are not in the game loop thread counters, add them to the frame
+        ScopedAllocationCount count;
+        entry.job_();
+        AddFrameAllocations(count.Get());
+    }
+    else {
+        entry.job_();
+    }
+    entry.counter_->n_.fetch_sub(1, std::memory_order_release);
+
+    return true;
+}
+
+bool JobSystem::TryPop(unsigned int index, bool newest, Entry& entry)
+{
+    auto& worker = *workers_[index];
+    std::lock_guard<std::mutex> lock(worker.mutex_);
+    if (worker.jobs_.empty()) return false;
+
+    if (newest) {
+        entry = std::move(worker.jobs_.back());
+        worker.jobs_.pop_back();
+    }
+    else {
+        entry = std::move(worker.jobs_.front());
+        worker.jobs_.pop_front();
+    }
+    // Together with the pop, so nQueued_ never drops below the number of queued jobs
+    nQueued_--;
+
+    return true;
+}
+
+}  // namespace Util
+
+}  // namespace FA
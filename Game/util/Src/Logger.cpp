@@ -15,12 +15,15 @@
 
 #include "Entry.h"
 #include "LogLevel.h"
+#include "RingBuffer.h"
 
 namespace FA {
 
 namespace Util {
 
-Logger::Logger() = default;
+Logger::Logger()
+    : queue_(std::make_unique<Queue>())
+{}
 
 Logger::~Logger()
 {
@@ -36,7 +39,10 @@ void Logger::OpenLog(const std::string& folder, const std::string& fileName, boo
     logStream_.open(filePath_);
 
     if (logStream_.is_open()) {
+        std::lock_guard<std::mutex> lock(writeMutex_);
         OpeningLines();
+        running_ = true;
+        writer_ = std::thread(&Logger::WriterLoop, this);
     }
 
 #ifdef _DEBUG
@@ -48,6 +54,16 @@ void Logger::OpenLog(const std::string& folder, const std::string& fileName, boo
 
 void Logger::CloseLog()
 {
+    if (writer_.joinable()) {
+        running_ = false;
+        // Callers that saw running_ before it was cleared finish their push, then it is drained below
+        while (nPushing_ > 0) std::this_thread::yield();
+        wakeCond_.notify_one();
+        writer_.join();
+        Drain();
+    }
+
+    std::lock_guard<std::mutex> lock(writeMutex_);
     if (logStream_.is_open()) {
         ClosingLines();
         logStream_.close();
@@ -74,10 +90,52 @@ void Logger::MakeErrorLogEntry(const std::string& fn, const std::string& logStr)
     LogEntry({LogLevel::Error, fn, logStr});
 }
 
-void Logger::LogStr(const std::string& logStr)
+void Logger::LogStr(std::string&& logStr)
+{
+    nPushing_++;
+    if (running_) {
+        if (!queue_->TryPush(std::move(logStr))) {
+            nDropped_++;
+        }
+        nPushing_--;
+        return;
+    }
+    nPushing_--;
+
+    std::lock_guard<std::mutex> lock(writeMutex_);
+    WriteStr(logStr);
+}
+
+void Logger::LogEntry(const Entry& entry)
+{
+    LogStr(entry.Str() + '\n');
+}
+
+void Logger::WriterLoop()
+{
+    while (running_) {
+        Drain();
+        std::unique_lock<std::mutex> lock(wakeMutex_);
+        wakeCond_.wait_for(lock, std::chrono::milliseconds(10));
+    }
+}
+
+void Logger::Drain()
+{
+    std::lock_guard<std::mutex> lock(writeMutex_);
+    std::string logStr;
+    bool written = false;
+    while (queue_->TryPop(logStr)) {
+        WriteStr(logStr);
+        written = true;
+    }
+    if (written && logStream_.is_open()) logStream_.flush();
+}
+
+void Logger::WriteStr(const std::string& logStr)
 {
     if (logStream_.is_open()) {
-        currSize_ = (logStream_ << logStr << std::flush).tellp();
+        currSize_ = (logStream_ << logStr).tellp();
         if (currSize_ > maxSize_) {
             logStream_ << std::endl << std::endl;
             logStream_ << "Logfile closing - file too large - " << filePath_ << std::endl;
@@ -93,34 +151,22 @@ void Logger::LogStr(const std::string& logStr)
 #endif
 }
 
-void Logger::LogEntry(const Entry& entry)
-{
-    LogStr(entry.Str());
-    EndLine();
-}
-
-void Logger::EndLine()
-{
-    std::stringstream ss;
-    ss << std::endl;
-    LogStr(ss.str());
-}
-
 void Logger::OpeningLines()
 {
     std::stringstream ss;
     ss << "Log file open - " << TimeStr();
     ss << "Log file path - " << filePath_ << std::endl;
     ss << std::endl << std::endl;
-    LogStr(ss.str());
+    WriteStr(ss.str());
 }
 
 void Logger::ClosingLines()
 {
     std::stringstream ss;
     ss << std::endl << std::endl;
+    if (nDropped_ > 0) ss << "Log entries dropped - " << nDropped_ << std::endl;
     ss << "Log file close - " << TimeStr();
-    LogStr(ss.str());
+    WriteStr(ss.str());
 }
 
 std::string Logger::TimeStr()
@@ -0,0 +1,79 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "PhaseGraph.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+#include "JobSystem.h"
+#include "Profiler.h"
+
+namespace FA {
+
+namespace Util {
+
+namespace {
+
+bool Overlaps(const std::vector<std::string>& lhs, const std::vector<std::string>& rhs)
+{
+    return std::any_of(lhs.begin(), lhs.end(),
+                       [&rhs](const std::string& r) { return std::find(rhs.begin(), rhs.end(), r) != rhs.end(); });
+}
+
+}  // namespace
+
+void PhaseGraph::AddPhase(const char* name, const std::vector<std::string>& reads,
+                          const std::vector<std::string>& writes, Fn fn)
+{
+    auto index = phases_.size();
+    Phase phase{name, reads, writes, fn, {}, {}};
+    for (std::size_t i = 0; i < index; i++) {
+        auto& other = phases_[i];
+        bool conflict = Overlaps(writes, other.reads_) || Overlaps(writes, other.writes_) ||
+                        Overlaps(reads, other.writes_);
+        if (conflict) {
+            phase.dependencies_.push_back(i);
+            other.successors_.push_back(index);
+        }
+    }
+    phases_.push_back(std::move(phase));
+}
+
+void PhaseGraph::Run(JobSystem& jobSystem) const
+{
+    auto nPhases = phases_.size();
+    std::unique_ptr<std::atomic<std::size_t>[]> remaining(new std::atomic<std::size_t>[nPhases]);
+    for (std::size_t i = 0; i < nPhases; i++) {
+        remaining[i] = phases_[i].dependencies_.size();
+    }
+
+    JobSystem::Counter counter;
+    std::function<void(std::size_t)> runPhase = [&](std::size_t index) {
+        const auto& phase = phases_[index];
+        {
+            PROFILE_ZONE(phase.name_);
+            phase.fn_();
+        }
+        for (auto successor : phase.successors_) {
+            if (--remaining[successor] == 0) {
+                jobSystem.Run([&runPhase, successor]() { runPhase(successor); }, counter);
+            }
+        }
+    };
+
+    for (std::size_t i = 0; i < nPhases; i++) {
+        if (phases_[i].dependencies_.empty()) {
+            jobSystem.Run([&runPhase, i]() { runPhase(i); }, counter);
+        }
+    }
+    jobSystem.Wait(counter);
+}
+
+}  // namespace Util
+
+}  // namespace FA
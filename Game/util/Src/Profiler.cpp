@@ -0,0 +1,170 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "Profiler.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+namespace FA {
+
+namespace Util {
+
+namespace {
+
+void WriteJsonString(std::ostream& os, const std::string& str)
+{
+    os << '"';
+    for (auto c : str) {
+        if (c == '"' || c == '\\') os << '\\';
+        os << c;
+    }
+    os << '"';
+}
+
+}  // namespace
+
+constexpr std::size_t Profiler::eventCapacity;
+
+struct Profiler::ThreadBuffer
+{
+    unsigned int threadId_{};
+    std::string threadName_;
+    std::vector<Event> events_;
+    std::atomic<std::size_t> count_{0};
+};
+
+Profiler& Profiler::Instance()
+{
+    static Profiler profiler;
+    return profiler;
+}
+
+Profiler::Profiler()
+    : epoch_(Clock::now())
+{
+    static std::atomic<unsigned int> nextId{1};
+    id_ = nextId++;
+}
+
+Profiler::~Profiler() = default;
+
+void Profiler::SetThreadName(const std::string& name)
+{
+    auto& buffer = GetThreadBuffer();
+    std::lock_guard<std::mutex> lock(mutex_);
+    buffer.threadName_ = name;
+}
+
+void Profiler::AddEvent(const char* name, Clock::time_point start, Clock::time_point end,
+                        const AllocationStats& allocations)
+{
+    auto& buffer = GetThreadBuffer();
+    auto count = buffer.count_.load(std::memory_order_relaxed);
+    buffer.events_[count & (eventCapacity - 1)] = {name, start, end, allocations};
+    buffer.count_.store(count + 1, std::memory_order_release);
+}
+
+std::vector<Profiler::ThreadEvents> Profiler::GetEvents() const
+{
+    std::vector<ThreadEvents> result;
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    for (const auto& buffer : buffers_) {
+        ThreadEvents threadEvents{buffer->threadId_, buffer->threadName_, {}};
+        auto count = buffer->count_.load(std::memory_order_acquire);
+        auto first = count > eventCapacity ? count - eventCapacity : 0;
+        threadEvents.events_.reserve(count - first);
+        for (auto i = first; i < count; i++) {
+            threadEvents.events_.push_back(buffer->events_[i & (eventCapacity - 1)]);
+        }
+        result.push_back(std::move(threadEvents));
+    }
+
+    return result;
+}
+
+void Profiler::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& buffer : buffers_) {
+        buffer->count_.store(0, std::memory_order_relaxed);
+    }
+}
+
+void Profiler::WriteChromeTrace(std::ostream& os) const
+{
+    auto toUs = [this](Clock::time_point t) {
+        return std::chrono::duration<double, std::micro>(t - epoch_).count();
+    };
+    std::string separator = "\n";
+
+    os << "{\"traceEvents\": [" << std::fixed << std::setprecision(3);
+    for (const auto& threadEvents : GetEvents()) {
+        if (!threadEvents.threadName_.empty()) {
+            os << separator << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": "
+               << threadEvents.threadId_ << ", \"args\": {\"name\": ";
+            WriteJsonString(os, threadEvents.threadName_);
+            os << "}}";
+            separator = ",\n";
+        }
+        for (const auto& event : threadEvents.events_) {
+            os << separator << "{\"name\": ";
+            WriteJsonString(os, event.name_);
+            os << ", \"ph\": \"X\", \"pid\": 1, \"tid\": " << threadEvents.threadId_ << ", \"ts\": " << toUs(event.start_)
+               << ", \"dur\": " << toUs(event.end_) - toUs(event.start_);
+            if (event.allocations_.nAllocations_ > 0) {
+                os << ", \"args\": {\"allocations\": " << event.allocations_.nAllocations_
+                   << ", \"bytes\": " << event.allocations_.nBytes_ << "}";
+            }
+            os << "}";
+            separator = ",\n";
+        }
+    }
+    os << "\n]}\n";
+}
+
+bool Profiler::ExportChromeTrace(const std::string& filePath) const
+{
+    std::ofstream os(filePath);
+    if (!os.is_open()) return false;
+
+    WriteChromeTrace(os);
+
+    return true;
+}
+
+Profiler::ThreadBuffer& Profiler::GetThreadBuffer()
+{
+    struct CacheEntry
+    {
+        unsigned int ownerId_{};
+        ThreadBuffer* buffer_ = nullptr;
+    };
+    // One entry per profiler used on this thread, most recently added first. Compare ids rather than addresses,
+    // a new profiler may reuse the address of a destroyed one, whose entry is then never matched again.
+    thread_local std::vector<CacheEntry> cache;
+
+    auto it = std::find_if(cache.begin(), cache.end(), [this](const CacheEntry& e) { return e.ownerId_ == id_; });
+    if (it != cache.end()) return *it->buffer_;
+
+    auto buffer = std::make_unique<ThreadBuffer>();
+    buffer->events_.resize(eventCapacity);
+    auto result = buffer.get();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        buffer->threadId_ = static_cast<unsigned int>(buffers_.size());
+        buffers_.push_back(std::move(buffer));
+    }
+    cache.insert(cache.begin(), {id_, result});
+
+    return *result;
+}
+
+}  // namespace Util
+
+}  // namespace FA
@@ -26,6 +26,8 @@ public:
         return rangeRandLen(rng_);
     }
 
+    void Seed(unsigned int seed) { rng_.seed(seed); }
+
 private:
     std::mt19937 rng_;
 };
@@ -37,6 +39,11 @@ int RandomizeRange(int min, int max)
     return r.RandomizeRange(min, max);
 }
 
+void SetRandomSeed(unsigned int seed)
+{
+    r.Seed(seed);
+}
+
 }  // namespace Util
 
 }  // namespace FA
@@ -0,0 +1,100 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace FA {
+
+namespace Util {
+
+// Bounded lock-free multi producer/multi consumer queue. Each cell carries a sequence number telling
+// whether it is free for the next push or holds data for the next pop.
+template <class T, std::size_t Capacity>
+class RingBuffer
+{
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    RingBuffer()
+        : cells_(std::make_unique<Cell[]>(Capacity))
+    {
+        for (std::size_t i = 0; i < Capacity; i++) {
+            cells_[i].sequence_.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    RingBuffer(const RingBuffer&) = delete;
+    RingBuffer& operator=(const RingBuffer&) = delete;
+
+    bool TryPush(T&& item)
+    {
+        Cell* cell = nullptr;
+        auto pos = pushPos_.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &cells_[pos & mask_];
+            auto seq = cell->sequence_.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (pushPos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            }
+            else if (diff < 0) {
+                return false;  // full
+            }
+            else {
+                pos = pushPos_.load(std::memory_order_relaxed);
+            }
+        }
+        cell->data_ = std::move(item);
+        cell->sequence_.store(pos + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    bool TryPop(T& item)
+    {
+        Cell* cell = nullptr;
+        auto pos = popPos_.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &cells_[pos & mask_];
+            auto seq = cell->sequence_.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (popPos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            }
+            else if (diff < 0) {
+                return false;  // empty
+            }
+            else {
+                pos = popPos_.load(std::memory_order_relaxed);
+            }
+        }
+        item = std::move(cell->data_);
+        cell->sequence_.store(pos + mask_ + 1, std::memory_order_release);
+
+        return true;
+    }
+
+private:
+    struct Cell
+    {
+        std::atomic<std::size_t> sequence_{};
+        T data_{};
+    };
+
+    static constexpr std::size_t mask_ = Capacity - 1;
+    std::unique_ptr<Cell[]> cells_;
+    alignas(64) std::atomic<std::size_t> pushPos_{};
+    alignas(64) std::atomic<std::size_t> popPos_{};
+};
+
+}  // namespace Util
+
+}  // namespace FA
@@ -0,0 +1,91 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+
+#include "AllocationTracker.h"
+
+using namespace testing;
+
+namespace FA {
+
+namespace Util {
+
+class AllocationTrackerTest : public Test
+{
+protected:
+    void SetUp() override { EnableAllocationTracking(true); }
+    void TearDown() override { EnableAllocationTracking(false); }
+};
+
+TEST_F(AllocationTrackerTest, NewShouldBeCounted)
+{
+    ScopedAllocationCount count;
+    auto p = std::make_unique<int>(3);
+    auto a = std::make_unique<char[]>(100);
+
+    EXPECT_EQ(count.Get().nAllocations_, 2u);
+    EXPECT_EQ(count.Get().nBytes_, sizeof(int) + 100u);
+}
+
+TEST_F(AllocationTrackerTest, NewShouldNotBeCountedWhenDisabled)
+{
+    ScopedAllocationCount count;
+    EnableAllocationTracking(false);
+    auto p = std::make_unique<int>(3);
+
+    EXPECT_EQ(count.Get(), AllocationStats());
+}
+
+TEST_F(AllocationTrackerTest, NewInOtherThreadShouldNotBeCounted)
+{
+    ScopedAllocationCount count;
+    AllocationStats threadStats;
+    std::thread t([&threadStats]() {
+        ScopedAllocationCount threadCount;
+        auto p = std::make_unique<int>(3);
+        threadStats = threadCount.Get();
+    });
+    t.join();
+    auto threadAllocations = count.Get().nAllocations_;
+
+    EXPECT_EQ(threadStats.nAllocations_, 1u);
+    auto p = std::make_unique<int>(3);
+    EXPECT_EQ(count.Get().nAllocations_, threadAllocations + 1);
+}
+
+TEST_F(AllocationTrackerTest, EndFrameShouldReturnAllocationsSincePreviousFrame)
+{
+    EndAllocationFrame();
+    auto p1 = std::make_unique<int>(1);
+    auto p2 = std::make_unique<int>(2);
+    EndAllocationFrame();
+
+    EXPECT_EQ(GetFrameAllocationStats(), (AllocationStats{2, 2 * sizeof(int)}));
+
+    EndAllocationFrame();
+    EXPECT_EQ(GetFrameAllocationStats(), AllocationStats());
+}
+
+TEST_F(AllocationTrackerTest, EndFrameShouldIncludeAddedAllocations)
+{
+    EndAllocationFrame();
+    AddFrameAllocations({2, 16});
+    EndAllocationFrame();
+
+    EXPECT_EQ(GetFrameAllocationStats(), (AllocationStats{2, 16}));
+
+    EndAllocationFrame();
+    EXPECT_EQ(GetFrameAllocationStats(), AllocationStats());
+}
+
+}  // namespace Util
+
+}  // namespace FA
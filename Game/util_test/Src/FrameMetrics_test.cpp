@@ -0,0 +1,139 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include "FrameMetrics.h"
+
+using namespace testing;
+
+namespace FA {
+
+namespace Util {
+
+TEST(FrameMetricsTest, ComputePercentilesShouldUseNearestRank)
+{
+    std::vector<double> samples;
+    for (int i = 100; i >= 1; i--) {
+        samples.push_back(static_cast<double>(i));
+    }
+    Percentiles expected{50.0, 95.0, 99.0, 100.0, 100};
+
+    EXPECT_EQ(ComputePercentiles(samples), expected);
+}
+
+TEST(FrameMetricsTest, ComputePercentilesOfOneSampleShouldReturnSample)
+{
+    Percentiles expected{2.5, 0.0, 0.0, 2.5, 1};
+
+    EXPECT_EQ(ComputePercentiles({2.5}), expected);
+    EXPECT_EQ(ComputePercentiles({}), Percentiles());
+}
+
+TEST(FrameMetricsTest, ComputePercentilesShouldLeaveOutP95AndP99OfFewSamples)
+{
+    std::vector<double> samples(minSamplesP95 - 2, 1.0);
+    samples.push_back(2.0);
+
+    auto percentiles = ComputePercentiles(samples);
+
+    EXPECT_FALSE(percentiles.HasP95());
+    EXPECT_EQ(percentiles.p95_, 0.0);
+    EXPECT_EQ(percentiles.p99_, 0.0);
+    EXPECT_EQ(percentiles.max_, 2.0);
+    samples.push_back(2.0);
+    EXPECT_EQ(ComputePercentiles(samples).p95_, 2.0);
+}
+
+TEST(FrameMetricsTest, ComputeShouldReturnPercentilesPerPhase)
+{
+    FrameTimings timings;
+    timings.Add("Frame", 2.0);
+    timings.Add("Frame", 4.0);
+    timings.Add("Draw", 1.0);
+
+    auto metrics = timings.Compute();
+
+    EXPECT_EQ(timings.Count("Frame"), 2u);
+    EXPECT_EQ(metrics.size(), 2u);
+    EXPECT_EQ(metrics["Frame"], (Percentiles{2.0, 0.0, 0.0, 4.0, 2}));
+    EXPECT_EQ(metrics["Draw"], (Percentiles{1.0, 0.0, 0.0, 1.0, 1}));
+}
+
+TEST(FrameMetricsTest, ReadShouldReturnWrittenMetrics)
+{
+    FrameMetrics expected;
+    expected["Frame"] = {8.25, 12.5, 16.0, 33.5, 1000};
+    expected["Update"] = {1.0, 0.0, 0.0, 4.0, 10};
+    std::stringstream stream;
+    EXPECT_TRUE(WriteFrameMetrics(stream, expected));
+
+    FrameMetrics metrics;
+    EXPECT_TRUE(ReadFrameMetrics(stream, metrics));
+    EXPECT_EQ(metrics, expected);
+}
+
+TEST(FrameMetricsTest, ReadInvalidJsonShouldFail)
+{
+    std::stringstream stream("{\"Frame\": {\"p50\": }");
+    FrameMetrics metrics;
+
+    EXPECT_FALSE(ReadFrameMetrics(stream, metrics));
+}
+
+TEST(FrameMetricsTest, CompareShouldReturnMetricsAboveTolerance)
+{
+    FrameMetrics baseline;
+    baseline["Frame"] = {10.0, 10.0, 10.0, 10.0, 100};
+    FrameMetrics current;
+    current["Frame"] = {10.5, 11.5, 10.0, 20.0, 100};
+    current["New"] = {100.0, 100.0, 100.0, 100.0, 100};
+
+    auto regressions = CompareFrameMetrics(baseline, current, 0.1);
+
+    ASSERT_EQ(regressions.size(), 1u);
+    EXPECT_THAT(regressions[0].phase_, StrEq("Frame"));
+    EXPECT_THAT(regressions[0].metric_, StrEq("p95"));
+    EXPECT_DOUBLE_EQ(regressions[0].baseline_, 10.0);
+    EXPECT_DOUBLE_EQ(regressions[0].value_, 11.5);
+}
+
+TEST(FrameMetricsTest, CompareShouldOnlyUseP50OfFewSamples)
+{
+    FrameMetrics baseline;
+    baseline["Bench"] = {10.0, 0.0, 0.0, 10.0, 10};
+    FrameMetrics current;
+    current["Bench"] = {10.5, 0.0, 0.0, 30.0, 10};
+
+    EXPECT_TRUE(CompareFrameMetrics(baseline, current, 0.1).empty());
+
+    current["Bench"].p50_ = 11.5;
+    auto regressions = CompareFrameMetrics(baseline, current, 0.1);
+
+    ASSERT_EQ(regressions.size(), 1u);
+    EXPECT_THAT(regressions[0].metric_, StrEq("p50"));
+}
+
+TEST(FrameMetricsTest, MissingInBaselineShouldReturnPhasesNotInBaseline)
+{
+    FrameMetrics baseline;
+    baseline["Frame"] = {10.0, 0.0, 0.0, 10.0, 10};
+    FrameMetrics current;
+    current["Frame"] = {10.0, 0.0, 0.0, 10.0, 10};
+    current["New"] = {10.0, 0.0, 0.0, 10.0, 10};
+
+    auto missing = MissingInBaseline(baseline, current);
+
+    ASSERT_EQ(missing.size(), 1u);
+    EXPECT_THAT(missing[0], StrEq("New"));
+}
+
+}  // namespace Util
+
+}  // namespace FA
@@ -0,0 +1,84 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include "InputRecording.h"
+
+using namespace testing;
+
+namespace FA {
+
+namespace Util {
+
+namespace {
+
+InputRecording CreateRecording()
+{
+    InputRecording recording;
+    recording.seed_ = 4711;
+    recording.frames_.push_back({0.016f, {}});
+    recording.frames_.push_back({0.017f,
+                                 {{InputRecording::EventType::KeyPressed, 71},
+                                  {InputRecording::EventType::KeyReleased, 0},
+                                  {InputRecording::EventType::KeyPressed, -1}}});
+    recording.frames_.push_back({0.015f, {{InputRecording::EventType::LostFocus, 0}}});
+    recording.frames_.push_back({0.0166f, {{InputRecording::EventType::Closed, 0}}});
+
+    return recording;
+}
+
+}  // namespace
+
+TEST(InputRecordingTest, ReadShouldReturnWrittenRecording)
+{
+    auto expected = CreateRecording();
+    std::stringstream stream;
+    EXPECT_TRUE(WriteInputRecording(stream, expected));
+
+    InputRecording recording;
+    EXPECT_TRUE(ReadInputRecording(stream, recording));
+    EXPECT_EQ(recording, expected);
+}
+
+TEST(InputRecordingTest, ReadEmptyRecordingShouldSucceed)
+{
+    InputRecording expected;
+    std::stringstream stream;
+    WriteInputRecording(stream, expected);
+
+    InputRecording recording = CreateRecording();
+    EXPECT_TRUE(ReadInputRecording(stream, recording));
+    EXPECT_EQ(recording, expected);
+}
+
+TEST(InputRecordingTest, ReadWithWrongMagicShouldFail)
+{
+    std::stringstream stream("XXXX");
+    InputRecording recording;
+
+    EXPECT_FALSE(ReadInputRecording(stream, recording));
+}
+
+TEST(InputRecordingTest, ReadTruncatedRecordingShouldFailAndKeepRecording)
+{
+    std::stringstream stream;
+    WriteInputRecording(stream, CreateRecording());
+    auto str = stream.str();
+    std::stringstream truncated(str.substr(0, str.size() - 2));
+
+    InputRecording recording;
+    recording.seed_ = 1;
+    EXPECT_FALSE(ReadInputRecording(truncated, recording));
+    EXPECT_EQ(recording.seed_, 1u);
+    EXPECT_TRUE(recording.frames_.empty());
+}
+
+}  // namespace Util
+
+}  // namespace FA
@@ -0,0 +1,128 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "AllocationTracker.h"
+#include "JobSystem.h"
+
+using namespace testing;
+
+namespace FA {
+
+namespace Util {
+
+TEST(JobSystemTest, RunWithoutWorkersShouldRunInCallingThread)
+{
+    JobSystem jobSystem;
+    JobSystem::Counter counter;
+    std::thread::id id;
+
+    jobSystem.Run([&id]() { id = std::this_thread::get_id(); }, counter);
+
+    EXPECT_TRUE(counter.IsDone());
+    EXPECT_EQ(id, std::this_thread::get_id());
+}
+
+TEST(JobSystemTest, WaitShouldReturnWhenAllJobsAreDone)
+{
+    JobSystem jobSystem;
+    jobSystem.Start(3);
+    JobSystem::Counter counter;
+    std::atomic<int> n{0};
+
+    for (int i = 0; i < 1000; i++) {
+        jobSystem.Run([&n]() { n++; }, counter);
+    }
+    jobSystem.Wait(counter);
+
+    EXPECT_TRUE(counter.IsDone());
+    EXPECT_EQ(n, 1000);
+}
+
+TEST(JobSystemTest, NestedJobsShouldBeWaitedFor)
+{
+    JobSystem jobSystem;
+    jobSystem.Start(2);
+    JobSystem::Counter counter;
+    std::atomic<int> n{0};
+
+    for (int i = 0; i < 10; i++) {
+        jobSystem.Run(
+            [&]() {
+                JobSystem::Counter inner;
+                for (int j = 0; j < 10; j++) {
+                    jobSystem.Run([&n]() { n++; }, inner);
+                }
+                jobSystem.Wait(inner);
+            },
+            counter);
+    }
+    jobSystem.Wait(counter);
+
+    EXPECT_EQ(n, 100);
+}
+
+TEST(JobSystemTest, ParallelForShouldCoverRangeOnce)
+{
+    JobSystem jobSystem;
+    jobSystem.Start(3);
+    std::vector<int> values(1001, 0);
+
+    jobSystem.ParallelFor(values.size(), 64, [&values](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; i++) {
+            values[i]++;
+        }
+    });
+
+    EXPECT_THAT(values, Each(1));
+}
+
+TEST(JobSystemTest, StopShouldRunQueuedJobs)
+{
+    JobSystem jobSystem;
+    jobSystem.Start(1);
+    JobSystem::Counter counter;
+    std::atomic<int> n{0};
+
+    for (int i = 0; i < 100; i++) {
+        jobSystem.Run([&n]() { n++; }, counter);
+    }
+    jobSystem.Stop();
+
+    EXPECT_EQ(jobSystem.GetWorkerCount(), 0u);
+    EXPECT_TRUE(counter.IsDone());
+    EXPECT_EQ(n, 100);
+}
+
+TEST(JobSystemTest, WorkerAllocationsShouldBeAddedToFrame)
+{
+    JobSystem jobSystem;
+    jobSystem.Start(3);
+    JobSystem::Counter counter;
+    std::vector<std::unique_ptr<int>> values(100);
+    EnableAllocationTracking(true);
+    EndAllocationFrame();
+
+    for (std::size_t i = 0; i < values.size(); i++) {
+        jobSystem.Run([&values, i]() { values[i] = std::make_unique<int>(3); }, counter);
+    }
+    jobSystem.Wait(counter);
+    EndAllocationFrame();
+    EnableAllocationTracking(false);
+
+    EXPECT_GE(GetFrameAllocationStats().nAllocations_, 100u);
+}
+
+}  // namespace Util
+
+}  // namespace FA
@@ -0,0 +1,140 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Logger.h"
+
+using namespace testing;
+
+namespace FA {
+
+namespace Util {
+
+namespace {
+
+const std::string entryTag = "entry ";
+
+// Records the written strings instead of writing them to file, and can stall the writer thread inside a write
+class RecordingLogger : public Logger
+{
+public:
+    std::vector<std::string> lines_;
+    std::atomic<bool> stalled_{false};
+
+    // Numbers of the entries made with MakeEntry, in written order
+    std::vector<unsigned int> WrittenEntries() const
+    {
+        std::vector<unsigned int> entries;
+        for (const auto& line : lines_) {
+            auto pos = line.find(entryTag);
+            if (pos != std::string::npos) {
+                entries.push_back(static_cast<unsigned int>(std::stoul(line.substr(pos + entryTag.size()))));
+            }
+        }
+        return entries;
+    }
+
+    void MakeEntry(unsigned int n) { MakeInfoLogEntry("test", entryTag + std::to_string(n)); }
+
+private:
+    virtual void WriteStr(const std::string& logStr) override
+    {
+        while (stalled_) {
+            std::this_thread::yield();
+        }
+        lines_.push_back(logStr);
+    }
+};
+
+}  // namespace
+
+class LoggerTest : public Test
+{
+protected:
+    const std::string fileName_ = "Logger_test.log";
+    RecordingLogger logger_;
+
+    virtual void SetUp() override { logger_.OpenLog(".", fileName_, false); }
+    virtual void TearDown() override
+    {
+        logger_.CloseLog();
+        std::remove(fileName_.c_str());
+    }
+};
+
+TEST_F(LoggerTest, EntriesShouldBeWrittenInOrder)
+{
+    const unsigned int nEntries = 1000;
+    for (unsigned int n = 0; n < nEntries; n++) {
+        logger_.MakeEntry(n);
+    }
+    logger_.CloseLog();
+
+    auto entries = logger_.WrittenEntries();
+    ASSERT_EQ(entries.size(), nEntries);
+    for (unsigned int n = 0; n < nEntries; n++) {
+        EXPECT_EQ(entries[n], n);
+    }
+    EXPECT_EQ(logger_.GetDroppedCount(), 0u);
+}
+
+TEST_F(LoggerTest, EntriesShouldBeDroppedAndCountedWhenQueueIsFull)
+{
+    // The queue holds 4096 entries, and the stalled writer thread holds at most one more
+    const unsigned int nEntries = 5000;
+    const unsigned int minDropped = nEntries - 4096 - 1;
+    logger_.stalled_ = true;
+    for (unsigned int n = 0; n < nEntries; n++) {
+        logger_.MakeEntry(n);
+    }
+    logger_.stalled_ = false;
+    logger_.CloseLog();
+
+    auto nDropped = logger_.GetDroppedCount();
+    auto entries = logger_.WrittenEntries();
+    EXPECT_GE(nDropped, minDropped);
+    EXPECT_EQ(entries.size() + nDropped, nEntries);
+    EXPECT_NE(logger_.lines_.back().find("Log entries dropped - " + std::to_string(nDropped)), std::string::npos);
+}
+
+TEST_F(LoggerTest, CloseLogShouldWriteAllPushedEntriesWhileOtherThreadsAreLogging)
+{
+    const unsigned int nThreads = 4;
+    std::atomic<bool> stop{false};
+    std::vector<unsigned int> nMade(nThreads, 0);
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0; t < nThreads; t++) {
+        threads.emplace_back([this, &stop, &nMade, t]() {
+            while (!stop) {
+                logger_.MakeEntry(nMade[t]++);
+            }
+        });
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    logger_.CloseLog();
+    stop = true;
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Entries made after CloseLog are written by the caller, so none may be missing
+    unsigned int nTotal = 0;
+    for (auto n : nMade) {
+        nTotal += n;
+    }
+    EXPECT_EQ(logger_.WrittenEntries().size() + logger_.GetDroppedCount(), nTotal);
+}
+
+}  // namespace Util
+
+}  // namespace FA
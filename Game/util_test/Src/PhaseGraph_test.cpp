@@ -0,0 +1,84 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "JobSystem.h"
+#include "PhaseGraph.h"
+
+using namespace testing;
+
+namespace FA {
+
+namespace Util {
+
+TEST(PhaseGraphTest, AddPhaseShouldDependOnConflictingPhases)
+{
+    PhaseGraph graph;
+    graph.AddPhase("A", {}, {"Tiles"}, []() {});
+    graph.AddPhase("B", {}, {"Entities"}, []() {});
+    graph.AddPhase("C", {"Entities"}, {"Camera"}, []() {});
+    graph.AddPhase("D", {"Entities"}, {"Collisions"}, []() {});
+    graph.AddPhase("E", {}, {"Entities", "Collisions"}, []() {});
+
+    EXPECT_THAT(graph.GetDependencies(0), IsEmpty());
+    EXPECT_THAT(graph.GetDependencies(1), IsEmpty());
+    EXPECT_THAT(graph.GetDependencies(2), ElementsAre(1));
+    EXPECT_THAT(graph.GetDependencies(3), ElementsAre(1));
+    EXPECT_THAT(graph.GetDependencies(4), ElementsAre(1, 2, 3));
+}
+
+TEST(PhaseGraphTest, RunShouldRunDependentPhasesInOrder)
+{
+    JobSystem jobSystem;
+    jobSystem.Start(3);
+    PhaseGraph graph;
+    std::mutex mutex;
+    std::vector<std::string> order;
+    auto record = [&](const std::string& name) {
+        return [&, name]() {
+            std::lock_guard<std::mutex> lock(mutex);
+            order.push_back(name);
+        };
+    };
+    graph.AddPhase("Create", {}, {"Entities"}, record("Create"));
+    graph.AddPhase("Tiles", {}, {"Tiles"}, record("Tiles"));
+    graph.AddPhase("Update", {}, {"Entities"}, record("Update"));
+    graph.AddPhase("Detect", {"Entities"}, {"Collisions"}, record("Detect"));
+    graph.AddPhase("Handle", {"Collisions"}, {"Entities"}, record("Handle"));
+
+    for (int i = 0; i < 100; i++) {
+        order.clear();
+        graph.Run(jobSystem);
+
+        order.erase(std::remove(order.begin(), order.end(), "Tiles"), order.end());
+        ASSERT_THAT(order, ElementsAre("Create", "Update", "Detect", "Handle"));
+    }
+}
+
+TEST(PhaseGraphTest, RunWithoutWorkersShouldRunSuccessorsBeforeNextIndependentPhase)
+{
+    JobSystem jobSystem;
+    PhaseGraph graph;
+    std::vector<std::string> order;
+    graph.AddPhase("A", {}, {"X"}, [&order]() { order.push_back("A"); });
+    graph.AddPhase("B", {}, {"Y"}, [&order]() { order.push_back("B"); });
+    graph.AddPhase("C", {"X"}, {}, [&order]() { order.push_back("C"); });
+
+    graph.Run(jobSystem);
+
+    EXPECT_THAT(order, ElementsAre("A", "C", "B"));
+}
+
+}  // namespace Util
+
+}  // namespace FA
@@ -0,0 +1,165 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <thread>
+
+#include "Profiler.h"
+
+using namespace testing;
+
+namespace FA {
+
+namespace Util {
+
+namespace {
+
+// Events of all threads, since other tests may have used the profiler instance from other threads
+std::vector<Profiler::Event> GetAllEvents(const Profiler& profiler)
+{
+    std::vector<Profiler::Event> result;
+    for (const auto& threadEvents : profiler.GetEvents()) {
+        result.insert(result.end(), threadEvents.events_.begin(), threadEvents.events_.end());
+    }
+
+    return result;
+}
+
+}  // namespace
+
+class ProfilerTest : public Test
+{
+protected:
+    Profiler profiler_;
+    Profiler::Clock::time_point t0_ = Profiler::Clock::now();
+};
+
+TEST_F(ProfilerTest, AddEventShouldBeReturnedForCallingThread)
+{
+    profiler_.AddEvent("Update", t0_, t0_ + std::chrono::microseconds(5));
+
+    auto threads = profiler_.GetEvents();
+    ASSERT_THAT(threads, SizeIs(1));
+    ASSERT_THAT(threads[0].events_, SizeIs(1));
+    EXPECT_THAT(threads[0].events_[0].name_, StrEq("Update"));
+}
+
+TEST_F(ProfilerTest, EventsFromOtherThreadShouldGetOwnBuffer)
+{
+    profiler_.AddEvent("Main", t0_, t0_);
+    std::thread worker([this]() {
+        profiler_.SetThreadName("worker");
+        profiler_.AddEvent("Job", t0_, t0_);
+    });
+    worker.join();
+
+    auto threads = profiler_.GetEvents();
+    ASSERT_THAT(threads, SizeIs(2));
+    EXPECT_NE(threads[0].threadId_, threads[1].threadId_);
+    EXPECT_EQ(threads[1].threadName_, "worker");
+}
+
+TEST_F(ProfilerTest, AlternatingProfilersShouldKeepOneBufferEach)
+{
+    Profiler other;
+    for (int i = 0; i < 3; i++) {
+        profiler_.AddEvent("First", t0_, t0_);
+        other.AddEvent("Second", t0_, t0_);
+    }
+
+    auto threads = profiler_.GetEvents();
+    ASSERT_THAT(threads, SizeIs(1));
+    EXPECT_THAT(threads[0].events_, SizeIs(3));
+    ASSERT_THAT(other.GetEvents(), SizeIs(1));
+}
+
+TEST_F(ProfilerTest, FullBufferShouldKeepNewestEvents)
+{
+    for (std::size_t i = 0; i < Profiler::eventCapacity; i++) {
+        profiler_.AddEvent("Old", t0_, t0_);
+    }
+    profiler_.AddEvent("New", t0_, t0_);
+
+    auto events = profiler_.GetEvents()[0].events_;
+    ASSERT_THAT(events, SizeIs(Profiler::eventCapacity));
+    EXPECT_THAT(events.back().name_, StrEq("New"));
+}
+
+TEST_F(ProfilerTest, ClearShouldRemoveEvents)
+{
+    profiler_.AddEvent("Update", t0_, t0_);
+    profiler_.Clear();
+
+    EXPECT_THAT(profiler_.GetEvents()[0].events_, IsEmpty());
+}
+
+TEST_F(ProfilerTest, WriteChromeTraceShouldWriteCompleteEvents)
+{
+    profiler_.AddEvent("Draw", t0_, t0_ + std::chrono::microseconds(2));
+    std::stringstream ss;
+    profiler_.WriteChromeTrace(ss);
+
+    EXPECT_THAT(ss.str(), StartsWith("{\"traceEvents\": ["));
+    EXPECT_THAT(ss.str(), HasSubstr("\"name\": \"Draw\", \"ph\": \"X\""));
+    EXPECT_THAT(ss.str(), HasSubstr("\"dur\": 2.000"));
+}
+
+TEST_F(ProfilerTest, WriteChromeTraceShouldWriteAllocationsAsArgs)
+{
+    profiler_.AddEvent("Update", t0_, t0_, {3, 48});
+    std::stringstream ss;
+    profiler_.WriteChromeTrace(ss);
+
+    EXPECT_THAT(ss.str(), HasSubstr("\"args\": {\"allocations\": 3, \"bytes\": 48}"));
+}
+
+TEST(ProfileZoneTest, DisabledProfilerShouldNotRecordZone)
+{
+    Profiler::Instance().Enable(false);
+    Profiler::Instance().Clear();
+    {
+        PROFILE_ZONE("Zone");
+    }
+    EXPECT_THAT(GetAllEvents(Profiler::Instance()), IsEmpty());
+}
+
+TEST(ProfileZoneTest, EnabledProfilerShouldRecordZone)
+{
+    Profiler::Instance().Enable(true);
+    Profiler::Instance().Clear();
+    {
+        PROFILE_ZONE("Zone");
+    }
+    Profiler::Instance().Enable(false);
+
+    auto events = GetAllEvents(Profiler::Instance());
+    ASSERT_THAT(events, SizeIs(1));
+    EXPECT_THAT(events[0].name_, StrEq("Zone"));
+}
+
+TEST(ProfileZoneTest, ZoneShouldRecordAllocations)
+{
+    Profiler::Instance().Enable(true);
+    Profiler::Instance().Clear();
+    EnableAllocationTracking(true);
+    {
+        PROFILE_ZONE("Zone");
+        auto p = std::make_unique<int>(3);
+    }
+    EnableAllocationTracking(false);
+    Profiler::Instance().Enable(false);
+
+    auto events = GetAllEvents(Profiler::Instance());
+    ASSERT_THAT(events, SizeIs(1));
+    EXPECT_EQ(events[0].allocations_, (AllocationStats{1, sizeof(int)}));
+}
+
+}  // namespace Util
+
+}  // namespace FA
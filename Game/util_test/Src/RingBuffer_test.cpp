@@ -0,0 +1,82 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "RingBuffer.h"
+
+using namespace testing;
+
+namespace FA {
+
+namespace Util {
+
+TEST(RingBufferTest, PopShouldReturnItemsInPushOrder)
+{
+    RingBuffer<std::string, 4> ringBuffer;
+    EXPECT_TRUE(ringBuffer.TryPush("first"));
+    EXPECT_TRUE(ringBuffer.TryPush("second"));
+
+    std::string item;
+    EXPECT_TRUE(ringBuffer.TryPop(item));
+    EXPECT_EQ(item, "first");
+    EXPECT_TRUE(ringBuffer.TryPop(item));
+    EXPECT_EQ(item, "second");
+}
+
+TEST(RingBufferTest, PopFromEmptyShouldFail)
+{
+    RingBuffer<int, 4> ringBuffer;
+    int item = 0;
+
+    EXPECT_FALSE(ringBuffer.TryPop(item));
+}
+
+TEST(RingBufferTest, PushToFullShouldFailUntilPopped)
+{
+    RingBuffer<int, 2> ringBuffer;
+    EXPECT_TRUE(ringBuffer.TryPush(1));
+    EXPECT_TRUE(ringBuffer.TryPush(2));
+    EXPECT_FALSE(ringBuffer.TryPush(3));
+
+    int item = 0;
+    EXPECT_TRUE(ringBuffer.TryPop(item));
+    EXPECT_TRUE(ringBuffer.TryPush(3));
+}
+
+TEST(RingBufferTest, ConcurrentProducersShouldDeliverAllItems)
+{
+    constexpr int nProducers = 4;
+    constexpr int nItemsPerProducer = 10000;
+    RingBuffer<int, 1024> ringBuffer;
+    std::vector<std::thread> producers;
+
+    for (int p = 0; p < nProducers; p++) {
+        producers.emplace_back([&ringBuffer]() {
+            for (int i = 0; i < nItemsPerProducer; i++) {
+                while (!ringBuffer.TryPush(1)) std::this_thread::yield();
+            }
+        });
+    }
+
+    int sum = 0;
+    int item = 0;
+    while (sum < nProducers * nItemsPerProducer) {
+        if (ringBuffer.TryPop(item)) sum += item;
+    }
+    for (auto& producer : producers) producer.join();
+
+    EXPECT_EQ(sum, nProducers * nItemsPerProducer);
+    EXPECT_FALSE(ringBuffer.TryPop(item));
+}
+
+}  // namespace Util
+
+}  // namespace FA
@@ -6,23 +6,28 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include <SFML/System/Vector2.hpp>
+
 #include "CameraViews.h"
-#include "RenderTexture.h"
+#include "JobSystem.h"
+#include "PhaseGraph.h"
+#include "RenderCommandBuffer.h"
 #include "Resource/SheetManager.h"
 #include "Resource/TextureManager.h"
 #include "SfmlFwd.h"
-#include "Sprite.h"
 
 namespace FA {
 
 namespace Graphic {
 
+class AnimatedTileLayer;
+class ChunkedSpriteLayer;
 class View;
-class SpriteIf;
 class RenderTargetIf;
 
 }  // namespace Graphic
@@ -43,17 +48,27 @@ namespace Shared {
 
 class MessageBus;
 struct EntityData;
-template <class T>
-class AnimationIf;
-struct ImageFrame;
 
 }  // namespace Shared
 
+namespace Tile {
+
+struct TileMapData;
+
+}  // namespace Tile
+
 namespace World {
 
+class BackgroundChunks;
 class LevelCreator;
 class TileMap;
 
+// Levels created while enabled update in a job started by Interpolate, and Draw shows the level as it was when the
+// previous job finished. Simulation then overlaps drawing, at the cost of one frame latency. Sync must be called
+// before anything outside the level, like input, reaches the entities.
+void EnablePipelinedUpdate(bool enable);
+bool IsPipelinedUpdateEnabled();
+
 class Level
 {
 public:
@@ -61,20 +76,23 @@ public:
     ~Level();
 
     void Load(const std::string& levelName);
+    void Load(const Tile::TileMapData& tileMapData);
+    // Messages sent by the update, on any thread and in both modes, are queued on the message bus until the game loop
+    // calls DispatchQueuedMessages after Sync
     void Update(float deltaTime);
+    // Place entities and camera between last and current tick, alpha in [0, 1]
+    void Interpolate(float alpha);
     void Draw(Graphic::RenderTargetIf& renderTarget);
+    void Sync();  // waits for a started update job
 
     void Create();
     Graphic::View GetView() const;
 
 private:
     const sf::Vector2u viewSize_;
-    Graphic::RenderTexture backgroundTexture_;
-    Graphic::Sprite backgroundSprite_;
-    std::vector<std::shared_ptr<Graphic::SpriteIf>> fringeLayer_;
-    std::vector<
-        std::tuple<std::shared_ptr<Shared::AnimationIf<Shared::ImageFrame>>, std::shared_ptr<Graphic::SpriteIf>>>
-        animationLayer_;
+    std::unique_ptr<BackgroundChunks> background_;
+    std::unique_ptr<Graphic::ChunkedSpriteLayer> fringeLayer_;
+    std::unique_ptr<Graphic::AnimatedTileLayer> animationLayer_;
     Shared::MessageBus& messageBus_;
     Shared::TextureManager& textureManager_;
     Shared::SheetManager sheetManager_;
@@ -89,6 +107,23 @@ private:
     std::unique_ptr<Entity::ObjIdTranslator> objIdTranslator_;
     std::unique_ptr<LevelCreator> levelCreator_;
     const float zoomFactor_{0.4f};
+    Util::PhaseGraph updatePhases_;
+    float deltaTime_{};
+
+    struct Frame
+    {
+        Graphic::RenderCommandBuffer commands_;
+        sf::Vector2f viewCenter_;
+    };
+
+    const bool pipelined_;
+    std::array<Frame, 2> frames_;
+    std::size_t front_ = 0;  // frame that is drawn, the job records the other
+    std::vector<float> pendingTicks_;
+    std::vector<float> jobTicks_;
+    float jobAlpha_{};
+    bool isJobStarted_ = false;
+    Util::JobSystem::Counter job_;
 
 private:
     void LoadEntitySheets();
@@ -97,6 +132,13 @@ private:
     void CreateEntities();
     void HandleCreationPool();
     void HandleDeletionPool();
+    void AddUpdatePhases();
+    void UpdateTick(float deltaTime);
+    void InterpolatePositions(float alpha);
+    void RecordFrame(Frame& frame);
+    void DrawLevel(Graphic::RenderCommandBuffer& commands);
+    sf::Vector2f GetViewCenter() const;
+    sf::FloatRect GetVisibleArea(const sf::Vector2f& center) const;
 };
 
 }  // namespace World
@@ -0,0 +1,142 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "BackgroundChunks.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <SFML/Graphics/Color.hpp>
+
+#include "LevelCreator.h"
+#include "Profiler.h"
+#include "View.h"
+
+namespace FA {
+
+namespace World {
+
+BackgroundChunks::BackgroundChunks(const LevelCreator &levelCreator, const sf::Vector2u &tileSize,
+                                   unsigned int chunkSize, std::size_t budget)
+    : levelCreator_(levelCreator)
+    , tileSize_(tileSize)
+    , chunkSize_(chunkSize)
+    , budget_(budget)
+{}
+
+BackgroundChunks::~BackgroundChunks() = default;
+
+void BackgroundChunks::AddLayer(const std::vector<TileMap::TileData> &layer)
+{
+    int size = static_cast<int>(chunkSize_);
+    for (const auto &data : layer) {
+        int left = static_cast<int>(data.position_.x);
+        int top = static_cast<int>(data.position_.y);
+        int right = left + static_cast<int>(tileSize_.x) - 1;
+        int bottom = top + static_cast<int>(tileSize_.y) - 1;
+        for (int row = top / size; row <= bottom / size; row++) {
+            for (int column = left / size; column <= right / size; column++) {
+                tiles_[{row, column}].push_back(data);
+            }
+        }
+    }
+}
+
+void BackgroundChunks::DrawTo(Graphic::RenderTargetIf &renderTarget, const sf::FloatRect &visibleArea)
+{
+    PROFILE_ZONE("BackgroundChunks::DrawTo");
+    frame_++;
+    float size = static_cast<float>(chunkSize_);
+    float margin = size / 2.0f;
+
+    // Render chunks near the visible area ahead, before they are needed
+    int firstRow = static_cast<int>(std::floor((visibleArea.top - margin) / size));
+    int lastRow = static_cast<int>(std::floor((visibleArea.top + visibleArea.height + margin) / size));
+    int firstColumn = static_cast<int>(std::floor((visibleArea.left - margin) / size));
+    int lastColumn = static_cast<int>(std::floor((visibleArea.left + visibleArea.width + margin) / size));
+    for (int row = firstRow; row <= lastRow; row++) {
+        auto it = tiles_.lower_bound({row, firstColumn});
+        auto end = tiles_.upper_bound({row, lastColumn});
+        for (; it != end; ++it) {
+            Touch(it->first);
+        }
+    }
+
+    for (const auto &entry : chunks_) {
+        const auto &chunk = *entry.second;
+        sf::FloatRect bounds(chunk.key_.second * size, chunk.key_.first * size, size, size);
+        if (chunk.lastUsed_ == frame_ && bounds.intersects(visibleArea)) {
+            renderTarget.draw(chunk.sprite_);
+        }
+    }
+
+    TrimToBudget();
+}
+
+void BackgroundChunks::Touch(const Key &key)
+{
+    auto it = chunks_.find(key);
+    if (it != chunks_.end()) {
+        auto &chunk = *it->second;
+        chunk.lastUsed_ = frame_;
+        lru_.splice(lru_.begin(), lru_, chunk.lruIt_);
+        return;
+    }
+
+    // Chunks used this frame are never evicted, the budget is exceeded instead
+    std::unique_ptr<Chunk> chunk;
+    if (chunks_.size() >= budget_ && !lru_.empty() && lru_.back()->lastUsed_ != frame_) {
+        auto oldKey = lru_.back()->key_;
+        lru_.pop_back();
+        chunk = std::move(chunks_.at(oldKey));
+        chunks_.erase(oldKey);
+    }
+    else {
+        chunk = std::make_unique<Chunk>();
+        chunk->texture_.create(chunkSize_, chunkSize_);
+        chunk->sprite_.setTexture(chunk->texture_.getTexture());
+    }
+
+    chunk->key_ = key;
+    chunk->lastUsed_ = frame_;
+    Render(*chunk);
+    lru_.push_front(chunk.get());
+    chunk->lruIt_ = lru_.begin();
+    chunks_[key] = std::move(chunk);
+}
+
+void BackgroundChunks::TrimToBudget()
+{
+    while (chunks_.size() > budget_ && !lru_.empty() && lru_.back()->lastUsed_ != frame_) {
+        auto oldKey = lru_.back()->key_;
+        lru_.pop_back();
+        chunks_.erase(oldKey);
+    }
+}
+
+void BackgroundChunks::Render(Chunk &chunk) const
+{
+    PROFILE_ZONE("BackgroundChunks::Render");
+    float size = static_cast<float>(chunkSize_);
+    sf::Vector2f origin(chunk.key_.second * size, chunk.key_.first * size);
+    Graphic::View view;
+    view.setSize({size, size});
+    view.setCenter(origin + sf::Vector2f(size, size) / 2.0f);
+
+    chunk.texture_.clear();
+    chunk.texture_.setView(view);
+    Graphic::Sprite sprite;
+    for (const auto &data : tiles_.at(chunk.key_)) {
+        levelCreator_.SetupSprite(sprite, data);
+        chunk.texture_.draw(sprite);
+    }
+    chunk.texture_.display();
+    chunk.sprite_.setPosition(origin);
+}
+
+}  // namespace World
+
+}  // namespace FA
@@ -0,0 +1,83 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <SFML/Graphics/Rect.hpp>
+
+#include "RenderTexture.h"
+#include "Sprite.h"
+#include "TileMap.h"
+
+namespace FA {
+
+namespace Graphic {
+
+class RenderTargetIf;
+
+}  // namespace Graphic
+
+namespace World {
+
+class LevelCreator;
+
+// Background tile layers rendered into square chunk textures. A chunk is rendered when it comes within a margin of
+// the visible area, the least recently used chunk is reused for the next one. Chunks needed in the same frame may
+// exceed the budget, the excess is released at the end of that frame. So memory is bounded whatever the map size, and
+// no texture is larger than a chunk.
+class BackgroundChunks
+{
+public:
+    BackgroundChunks(const LevelCreator &levelCreator, const sf::Vector2u &tileSize, unsigned int chunkSize,
+                     std::size_t budget);
+    ~BackgroundChunks();
+
+    void AddLayer(const std::vector<TileMap::TileData> &layer);
+    void DrawTo(Graphic::RenderTargetIf &renderTarget, const sf::FloatRect &visibleArea);
+    std::size_t GetRenderedCount() const { return chunks_.size(); }
+    bool IsRendered(int row, int column) const { return chunks_.find({row, column}) != chunks_.end(); }
+
+private:
+    using Key = std::pair<int, int>;  // row and column
+
+    struct Chunk;
+    using LruList = std::list<Chunk *>;
+
+    struct Chunk
+    {
+        Graphic::RenderTexture texture_;
+        Graphic::Sprite sprite_;
+        Key key_{};
+        unsigned int lastUsed_{};
+        LruList::iterator lruIt_;
+    };
+
+private:
+    const LevelCreator &levelCreator_;
+    sf::Vector2u tileSize_;
+    unsigned int chunkSize_{};
+    std::size_t budget_{};
+    std::map<Key, std::vector<TileMap::TileData>> tiles_;  // tiles touching each chunk, in draw order
+    std::map<Key, std::unique_ptr<Chunk>> chunks_;
+    LruList lru_;  // most recently used first
+    unsigned int frame_{};
+
+private:
+    void Touch(const Key &key);
+    void TrimToBudget();
+    void Render(Chunk &chunk) const;
+};
+
+}  // namespace World
+
+}  // namespace FA
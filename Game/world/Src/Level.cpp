@@ -4,12 +4,18 @@
  *	See file LICENSE for full license details.
  */
 
+#define FA_LOG_CHANNEL FA::Shared::LogChannel::World
+
 #pragma once
 
 #include "Level.h"
 
-#include "Animation/Animation.h"
+#include <algorithm>
+
+#include "AnimatedTileLayer.h"
+#include "BackgroundChunks.h"
 #include "CameraView.h"
+#include "ChunkedSpriteLayer.h"
 #include "CollisionHandler.h"
 #include "DrawHandler.h"
 #include "EntityDb.h"
@@ -19,12 +25,12 @@
 #include "Factory.h"
 #include "Folder.h"
 #include "Id.h"
+#include "JobSystem.h"
 #include "LevelCreator.h"
 #include "Logging.h"
 #include "ObjIdTranslator.h"
+#include "Profiler.h"
 #include "RenderTargetIf.h"
-#include "Resource/ResourceId.h"
-#include "Resource/SpriteSheet.h"
 #include "Sheets.h"
 #include "TileMap.h"
 #include "View.h"
@@ -33,28 +39,70 @@ namespace FA {
 
 namespace World {
 
+namespace {
+
+const std::string entitiesResource = "Entities";
+const std::string cameraResource = "Camera";
+const std::string collisionsResource = "Collisions";
+const std::string animationLayerResource = "AnimationLayer";
+
+const unsigned int layerChunkTiles = 16;       // fringe and animation chunk side in tiles
+const unsigned int backgroundChunkSize = 512;  // chunk side in pixels
+const std::size_t backgroundBudget = 16;       // chunk textures kept, 16 MB
+const float entityCellSize = 256.0f;           // static entity index cell side in pixels
+
+bool pipelinedUpdate = false;
+
+}  // namespace
+
+void EnablePipelinedUpdate(bool enable)
+{
+    pipelinedUpdate = enable;
+}
+
+bool IsPipelinedUpdateEnabled()
+{
+    return pipelinedUpdate;
+}
+
 Level::Level(Shared::MessageBus &messageBus, Shared::TextureManager &textureManager, const sf::Vector2u &viewSize)
     : messageBus_(messageBus)
     , textureManager_(textureManager)
     , sheetManager_()
-    , tileMap_(std::make_unique<TileMap>(textureManager, sheetManager_))
+    , tileMap_(std::make_unique<TileMap>(sheetManager_))
     , viewSize_(viewSize)
     , factory_(std::make_unique<Entity::Factory>())
     , entityDb_(std::make_unique<Entity::EntityDb>())
     , collisionHandler_(std::make_unique<Entity::CollisionHandler>(*entityDb_))
-    , drawHandler_(std::make_unique<Entity::DrawHandler>(*entityDb_))
+    , drawHandler_(std::make_unique<Entity::DrawHandler>(*entityDb_, entityCellSize))
     , entityLifeHandler_(std::make_unique<Entity::EntityLifeHandler>())
     , entityHandler_(std::make_unique<Entity::EntityHandler>(*entityDb_))
     , objIdTranslator_(std::make_unique<Entity::ObjIdTranslator>())
     , levelCreator_(std::make_unique<LevelCreator>(textureManager, sheetManager_))
-{}
+    , pipelined_(pipelinedUpdate)
+{
+    drawHandler_->EnableYSort(Entity::LayerType::Ground);
+    AddUpdatePhases();
+}
 
-Level::~Level() = default;
+Level::~Level()
+{
+    Sync();
+}
 
 void Level::Load(const std::string &levelName)
 {
     LoadTileMap(levelName);
     LoadEntitySheets();
+    sheetManager_.BuildAtlas(textureManager_);
+}
+
+void Level::Load(const Tile::TileMapData &tileMapData)
+{
+    tileMap_->Load(tileMapData);
+    tileMap_->Setup();
+    LoadEntitySheets();
+    sheetManager_.BuildAtlas(textureManager_);
 }
 
 void Level::Create()
@@ -64,49 +112,154 @@ void Level::Create()
     cameraViews_.CreateCameraView(viewSize_, tileMap_->GetSize(),
                                   zoomFactor_);  // Entities need cameraView, create before
     CreateEntities();
+    if (pipelined_) {
+        RecordFrame(frames_[front_]);
+    }
     LOG_INFO_EXIT_FUNC();
 }
 
 Graphic::View Level::GetView() const
 {
-    auto &cameraView = cameraViews_.GetCameraView();
     Graphic::View view;
     view.setSize(static_cast<sf::Vector2f>(viewSize_));
     view.zoom(zoomFactor_);
-    view.setCenter(cameraView.GetPosition());
+    view.setCenter(GetViewCenter());
 
     return view;
 }
 
+sf::Vector2f Level::GetViewCenter() const
+{
+    return pipelined_ ? frames_[front_].viewCenter_ : cameraViews_.GetCameraView().GetPosition();
+}
+
+sf::FloatRect Level::GetVisibleArea(const sf::Vector2f &center) const
+{
+    auto size = static_cast<sf::Vector2f>(viewSize_) * zoomFactor_;
+
+    return {center - size / 2.0f, size};
+}
+
 void Level::Update(float deltaTime)
 {
-    HandleCreationPool();
-    cameraViews_.Update(deltaTime);
-    for (auto &element : animationLayer_) {
-        auto animation = std::get<0>(element);
-        auto sprite = std::get<1>(element);
-        animation->Update(deltaTime);
-        animation->ApplyTo(*sprite);
+    if (pipelined_) {
+        pendingTicks_.push_back(deltaTime);
+        return;
+    }
+
+    messageBus_.BeginDeferring();
+    UpdateTick(deltaTime);
+    messageBus_.EndDeferring();
+}
+
+void Level::Interpolate(float alpha)
+{
+    if (!pipelined_) {
+        InterpolatePositions(alpha);
+        return;
     }
 
-    entityHandler_->Update(deltaTime);
-    collisionHandler_->DetectCollisions();
-    collisionHandler_->DetectOutsideTileMap(tileMap_->GetSize());
-    collisionHandler_->HandleCollisions();
-    collisionHandler_->HandleOutsideTileMap();
-    HandleDeletionPool();
+    Sync();
+    jobTicks_.swap(pendingTicks_);
+    pendingTicks_.clear();
+    jobAlpha_ = alpha;
+    isJobStarted_ = true;
+    messageBus_.BeginDeferring();
+    Util::JobSystem::Instance().Run(
+        [this]() {
+            PROFILE_ZONE("Level::PipelinedUpdate");
+            for (auto deltaTime : jobTicks_) {
+                UpdateTick(deltaTime);
+            }
+            InterpolatePositions(jobAlpha_);
+            RecordFrame(frames_[1 - front_]);
+        },
+        job_);
 }
 
+void Level::Sync()
+{
+    if (!isJobStarted_) return;
+
+    PROFILE_ZONE("Level::Sync");
+    Util::JobSystem::Instance().Wait(job_);
+    messageBus_.EndDeferring();
+    front_ = 1 - front_;
+    isJobStarted_ = false;
+}
+
+void Level::UpdateTick(float deltaTime)
+{
+    PROFILE_ZONE("Level::Update");
+    deltaTime_ = deltaTime;
+    updatePhases_.Run(Util::JobSystem::Instance());
+}
+
+void Level::InterpolatePositions(float alpha)
+{
+    PROFILE_ZONE("Level::Interpolate");
+    entityHandler_->Interpolate(alpha);
+    cameraViews_.Update(0.0f);
+}
+
+void Level::RecordFrame(Frame &frame)
+{
+    PROFILE_ZONE("Level::RecordFrame");
+    frame.commands_.Clear();
+    DrawLevel(frame.commands_);
+    frame.viewCenter_ = cameraViews_.GetCameraView().GetPosition();
+}
+
+// Entity callbacks may change camera tracking and add or remove entities, so entity phases also write those
+void Level::AddUpdatePhases()
+{
+    updatePhases_.AddPhase("Level::HandleCreationPool", {}, {entitiesResource}, [this]() { HandleCreationPool(); });
+    updatePhases_.AddPhase("CameraViews::Update", {entitiesResource}, {cameraResource},
+                           [this]() { cameraViews_.Update(deltaTime_); });
+    updatePhases_.AddPhase("Level::UpdateAnimationLayer", {}, {animationLayerResource},
+                           [this]() { animationLayer_->Update(deltaTime_); });
+    updatePhases_.AddPhase("EntityHandler::Update", {}, {entitiesResource, cameraResource},
+                           [this]() { entityHandler_->Update(deltaTime_); });
+    updatePhases_.AddPhase("CollisionHandler::Detect", {entitiesResource}, {collisionsResource}, [this]() {
+        collisionHandler_->DetectCollisions();
+        collisionHandler_->DetectOutsideTileMap(tileMap_->GetSize());
+    });
+    updatePhases_.AddPhase("CollisionHandler::Handle", {}, {entitiesResource, cameraResource, collisionsResource},
+                           [this]() {
+                               collisionHandler_->HandleCollisions();
+                               collisionHandler_->HandleOutsideTileMap();
+                           });
+    updatePhases_.AddPhase("Level::HandleDeletionPool", {}, {entitiesResource}, [this]() { HandleDeletionPool(); });
+}
+
+// Background chunks are rendered here on the main thread, the update job never touches them
 void Level::Draw(Graphic::RenderTargetIf &renderTarget)
 {
-    renderTarget.draw(backgroundSprite_);
-    drawHandler_->DrawTo(renderTarget);
-    for (const auto &tile : fringeLayer_) {
-        renderTarget.draw(*tile);
+    background_->DrawTo(renderTarget, GetVisibleArea(GetViewCenter()));
+    auto &frame = frames_[front_];
+    if (!pipelined_) {
+        RecordFrame(frame);
+    }
+
+    PROFILE_ZONE("Level::ExecuteCommands");
+    frame.commands_.Execute(renderTarget);
+}
+
+void Level::DrawLevel(Graphic::RenderCommandBuffer &commands)
+{
+    PROFILE_ZONE("Level::Draw");
+    auto visibleArea = GetVisibleArea(cameraViews_.GetCameraView().GetPosition());
+    {
+        PROFILE_ZONE("DrawHandler::DrawTo");
+        drawHandler_->DrawTo(commands, visibleArea);
+    }
+    {
+        PROFILE_ZONE("Level::DrawFringeLayer");
+        fringeLayer_->DrawTo(commands, visibleArea);
     }
-    for (const auto &element : animationLayer_) {
-        auto sprite = std::get<1>(element);
-        renderTarget.draw(*sprite);
+    {
+        PROFILE_ZONE("Level::DrawAnimationLayer");
+        animationLayer_->DrawTo(commands, visibleArea);
     }
 }
 
@@ -114,11 +267,7 @@ void Level::LoadEntitySheets()
 {
     auto sheetPath = Util::GetAssetsPath() + "/tiny-RPG-forest-files/PNG/";
     for (const auto &sheetData : textureSheets) {
-        auto path = sheetPath + sheetData.path_;
-        Shared::ResourceId id = textureManager_.Load(path);
-        sf::Vector2u textureSize = textureManager_.Get(id)->getSize();
-        auto sheet = std::make_unique<Shared::SpriteSheet>(id, textureSize, sheetData.rectCount_);
-        sheetManager_.AddSheet(sheetData.name_, std::move(sheet));
+        sheetManager_.AddImageSheet(sheetData.name_, sheetPath + sheetData.path_, sheetData.rectCount_);
     }
 }
 
@@ -132,15 +281,13 @@ void Level::LoadTileMap(const std::string &levelName)
 void Level::CreateMap()
 {
     LOG_INFO("Create map");
-    levelCreator_->AddBackground(tileMap_->GetLayer("Ground Layer 1"));
-    levelCreator_->AddBackground(tileMap_->GetLayer("Ground Layer 2"));
-    auto size = tileMap_->GetSize();
-    backgroundTexture_.create(size.x, size.y);
-    levelCreator_->CreateBackground(backgroundTexture_);
-    backgroundTexture_.display();
-    backgroundSprite_.setTexture(backgroundTexture_.getTexture());
-    fringeLayer_ = levelCreator_->CreateFringe(tileMap_->GetLayer("Fringe Layer"));
-    animationLayer_ = levelCreator_->CreateAnimations(tileMap_->GetLayer("Dynamic Layer 1"));
+    auto tileSize = tileMap_->GetTileSize();
+    background_ = std::make_unique<BackgroundChunks>(*levelCreator_, tileSize, backgroundChunkSize, backgroundBudget);
+    background_->AddLayer(tileMap_->GetLayer("Ground Layer 1"));
+    background_->AddLayer(tileMap_->GetLayer("Ground Layer 2"));
+    float chunkSize = static_cast<float>(layerChunkTiles * std::max(tileSize.x, tileSize.y));
+    fringeLayer_ = levelCreator_->CreateFringe(tileMap_->GetLayer("Fringe Layer"), chunkSize);
+    animationLayer_ = levelCreator_->CreateAnimations(tileMap_->GetLayer("Dynamic Layer 1"), chunkSize);
 }
 
 void Level::CreateEntities()
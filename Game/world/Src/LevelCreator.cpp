@@ -8,12 +8,10 @@
 
 #include "LevelCreator.h"
 
-#include "Animation/Animation.h"
-#include "RenderTargetIf.h"
-#include "Resource/ImageFrame.h"
+#include "AnimatedTileLayer.h"
+#include "ChunkedSpriteLayer.h"
 #include "Resource/SheetManager.h"
 #include "Resource/TextureRect.h"
-#include "Sequence.h"
 #include "Sprite.h"
 
 namespace FA {
@@ -25,46 +23,44 @@ LevelCreator::LevelCreator(const Shared::TextureManager &textureManager, const S
     , sheetManager_(sheetManager)
 {}
 
-void LevelCreator::AddBackground(const std::vector<TileMap::TileData> &layer)
+void LevelCreator::SetupSprite(Graphic::SpriteIf &sprite, const TileMap::TileData &data) const
 {
-    layers_.push_back(layer);
-}
-
-void LevelCreator::CreateBackground(Graphic::RenderTargetIf &texture) const
-{
-    for (const auto &layer : layers_) {
-        for (const auto &data : layer) {
-            auto sprite = CreateSprite(data);
-            texture.draw(*sprite);
-        }
-    }
+    auto imageData = data.graphic_.image_;
+    auto textureRect = sheetManager_.GetTextureRect(imageData.sheetItem_);
+    const auto *texture = textureManager_.Get(textureRect.id_);
+    sprite.setTexture(*texture);
+    sprite.setTextureRect(textureRect.rect_);
+    sprite.setPosition(data.position_);
 }
 
-std::vector<std::shared_ptr<Graphic::SpriteIf>> LevelCreator::CreateFringe(
-    const std::vector<TileMap::TileData> &layer) const
+std::unique_ptr<Graphic::ChunkedSpriteLayer> LevelCreator::CreateFringe(const std::vector<TileMap::TileData> &layer,
+                                                                        float chunkSize) const
 {
-    std::vector<std::shared_ptr<Graphic::SpriteIf>> fringe;
+    auto fringe = std::make_unique<Graphic::ChunkedSpriteLayer>(chunkSize);
 
     for (const auto &data : layer) {
         auto sprite = CreateSprite(data);
-        fringe.push_back(sprite);
+        fringe->Add(*sprite);
     }
 
     return fringe;
 }
 
-std::vector<std::tuple<std::shared_ptr<Shared::AnimationIf<Shared::ImageFrame>>, std::shared_ptr<Graphic::SpriteIf>>>
-LevelCreator::CreateAnimations(const std::vector<TileMap::TileData> &layer) const
+// Tiles with the same frames share clip, so they animate with one clock
+std::unique_ptr<Graphic::AnimatedTileLayer> LevelCreator::CreateAnimations(const std::vector<TileMap::TileData> &layer,
+                                                                           float chunkSize) const
 {
-    std::vector<
-        std::tuple<std::shared_ptr<Shared::AnimationIf<Shared::ImageFrame>>, std::shared_ptr<Graphic::SpriteIf>>>
-        animations;
+    auto animations = std::make_unique<Graphic::AnimatedTileLayer>(chunkSize);
 
     for (const auto &data : layer) {
-        auto animation = CreateAnimation(data);
-        auto sprite = std::make_shared<Graphic::Sprite>();
-        sprite->setPosition(data.position_);
-        animations.push_back({animation, sprite});
+        std::vector<Graphic::AnimatedTileLayer::Frame> frames;
+        for (const auto &image : data.graphic_.animation_) {
+            auto textureRect = sheetManager_.GetTextureRect(image.sheetItem_);
+            const auto *texture = textureManager_.Get(textureRect.id_);
+            frames.push_back({texture, textureRect.rect_});
+        }
+        auto clip = animations->AddClip(frames, switchTime);
+        animations->AddInstance(clip, data.position_);
     }
 
     return animations;
@@ -72,36 +68,12 @@ LevelCreator::CreateAnimations(const std::vector<TileMap::TileData> &layer) cons
 
 std::shared_ptr<Graphic::SpriteIf> LevelCreator::CreateSprite(const TileMap::TileData &data) const
 {
-    auto imageData = data.graphic_.image_;
-    auto textureRect = sheetManager_.GetTextureRect(imageData.sheetItem_);
-    const auto *texture = textureManager_.Get(textureRect.id_);
     auto sprite = std::make_shared<Graphic::Sprite>();
-    sprite->setTexture(*texture);
-    sprite->setTextureRect(textureRect.rect_);
-    sprite->setPosition(data.position_);
+    SetupSprite(*sprite, data);
 
     return sprite;
 }
 
-std::shared_ptr<Shared::AnimationIf<Shared::ImageFrame>> LevelCreator::CreateAnimation(
-    const TileMap::TileData &data) const
-{
-    float t = switchTime;
-    auto seq = std::make_shared<Shared::Sequence<Shared::ImageFrame>>(t);
-    for (const auto &image : data.graphic_.animation_) {
-        auto textureRect = sheetManager_.GetTextureRect(image.sheetItem_);
-        auto textureSize = sf::Vector2i(textureRect.rect_.width, textureRect.rect_.height);
-        const auto *texture = textureManager_.Get(textureRect.id_);
-        sf::Vector2i center = textureSize / 2;
-        seq->Add({texture, textureRect.rect_, static_cast<sf::Vector2f>(center)});
-    }
-
-    auto animation = std::make_shared<Shared::Animation<Shared::ImageFrame>>(seq, false);
-    animation->Start();
-
-    return animation;
-}
-
 }  // namespace World
 
 }  // namespace FA
@@ -7,7 +7,6 @@
 #pragma once
 
 #include <memory>
-#include <tuple>
 #include <vector>
 
 #include "Resource/TextureManager.h"
@@ -17,7 +16,8 @@ namespace FA {
 
 namespace Graphic {
 
-class RenderTargetIf;
+class AnimatedTileLayer;
+class ChunkedSpriteLayer;
 class SpriteIf;
 
 }  // namespace Graphic
@@ -25,9 +25,6 @@ class SpriteIf;
 namespace Shared {
 
 class SheetManager;
-template <class T>
-class AnimationIf;
-struct ImageFrame;
 
 }  // namespace Shared
 
@@ -40,21 +37,18 @@ class LevelCreator
 public:
     LevelCreator(const Shared::TextureManager &textureManager, const Shared::SheetManager &sheetManager);
 
-    void AddBackground(const std::vector<TileMap::TileData> &layer);
-    void CreateBackground(Graphic::RenderTargetIf &texture) const;
-    std::vector<std::shared_ptr<Graphic::SpriteIf>> CreateFringe(const std::vector<TileMap::TileData> &layer) const;
-    std::vector<
-        std::tuple<std::shared_ptr<Shared::AnimationIf<Shared::ImageFrame>>, std::shared_ptr<Graphic::SpriteIf>>>
-    CreateAnimations(const std::vector<TileMap::TileData> &layer) const;
+    void SetupSprite(Graphic::SpriteIf &sprite, const TileMap::TileData &data) const;
+    std::unique_ptr<Graphic::ChunkedSpriteLayer> CreateFringe(const std::vector<TileMap::TileData> &layer,
+                                                              float chunkSize) const;
+    std::unique_ptr<Graphic::AnimatedTileLayer> CreateAnimations(const std::vector<TileMap::TileData> &layer,
+                                                                 float chunkSize) const;
 
 private:
     const Shared::TextureManager &textureManager_;
     const Shared::SheetManager &sheetManager_;
-    std::vector<std::vector<TileMap::TileData>> layers_;
 
 private:
     std::shared_ptr<Graphic::SpriteIf> CreateSprite(const TileMap::TileData &data) const;
-    std::shared_ptr<Shared::AnimationIf<Shared::ImageFrame>> CreateAnimation(const TileMap::TileData &data) const;
 };
 
 }  // namespace World
@@ -4,14 +4,13 @@
  *	See file LICENSE for full license details.
  */
 
+#define FA_LOG_CHANNEL FA::Shared::LogChannel::World
+
 #include "TileMap.h"
 
 #include "Logging.h"
 #include "Resource/ImageData.h"
-#include "Resource/ResourceId.h"
 #include "Resource/SheetManager.h"
-#include "Resource/SpriteSheet.h"
-#include "Resource/TextureManager.h"
 #include "TileMapData.h"
 #include "TileMapParser.h"
 
@@ -19,9 +18,8 @@ namespace FA {
 
 namespace World {
 
-TileMap::TileMap(Shared::TextureManager& textureManager, Shared::SheetManager& sheetManager)
-    : textureManager_(textureManager)
-    , sheetManager_(sheetManager)
+TileMap::TileMap(Shared::SheetManager& sheetManager)
+    : sheetManager_(sheetManager)
 {
     tileMapParser_ = std::make_unique<Tile::TileMapParser>();
 }
@@ -34,6 +32,12 @@ void TileMap::Load(const std::string& fileName)
     LoadTileSets();
 }
 
+void TileMap::Load(const Tile::TileMapData& tileMapData)
+{
+    tileMapData_ = std::make_unique<Tile::TileMapData>(tileMapData);
+    LoadTileSets();
+}
+
 void TileMap::Setup()
 {
     LOG_INFO("Setup tile map");
@@ -46,10 +50,7 @@ void TileMap::LoadTileSets()
     for (auto& entry : tileMapData_->tileSets_) {
         auto images = entry.second.images_;
         for (const auto& image : images) {
-            Shared::ResourceId id = textureManager_.Load(image.path_);
-            auto size = textureManager_.Get(id)->getSize();
-            auto sheet = std::make_unique<Shared::SpriteSheet>(id, size, sf::Vector2u(image.nCols_, image.nRows_));
-            sheetManager_.AddSheet(image.path_, std::move(sheet));
+            sheetManager_.AddImageSheet(image.path_, image.path_, sf::Vector2u(image.nCols_, image.nRows_));
         }
     }
 }
@@ -138,6 +139,14 @@ sf::Vector2u TileMap::GetSize() const
     return size;
 }
 
+sf::Vector2u TileMap::GetTileSize() const
+{
+    auto tileWidth = tileMapData_->mapProperties_.tileWidth_;
+    auto tileHeight = tileMapData_->mapProperties_.tileHeight_;
+
+    return sf::Vector2u(tileWidth, tileHeight);
+}
+
 Tile::TileData TileMap::LookupTileData(int id)
 {
     auto it = tileMapData_->tileSets_.lower_bound(id);
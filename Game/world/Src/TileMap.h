@@ -15,7 +15,6 @@
 #include <SFML/System/Vector2.hpp>
 
 #include "Resource/EntityData.h"
-#include "Resource/TextureManager.h"
 #include "Resource/TileGraphic.h"
 
 namespace FA {
@@ -46,16 +45,17 @@ public:
     };
 
 public:
-    TileMap(Shared::TextureManager &textureManager, Shared::SheetManager &sheetManager);
+    TileMap(Shared::SheetManager &sheetManager);
     ~TileMap();
     void Load(const std::string &fileName);
+    void Load(const Tile::TileMapData &tileMapData);
     void Setup();
     const std::vector<TileData> GetLayer(const std::string &name) const;
     const std::vector<Shared::EntityData> GetEntityGroup(const std::string &name) const;
     sf::Vector2u GetSize() const;
+    sf::Vector2u GetTileSize() const;
 
 private:
-    Shared::TextureManager &textureManager_;
     Shared::SheetManager &sheetManager_;
     std::unique_ptr<Tile::TileMapData> tileMapData_ = nullptr;
     std::unique_ptr<Tile::TileMapParser> tileMapParser_ = nullptr;
@@ -0,0 +1,143 @@
+/*
+ *	Copyright (C) 2025 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "BackgroundChunks.h"
+#include "LevelCreator.h"
+#include "Mock/LoggerMock.h"
+#include "RenderBackend.h"
+#include "RenderTargetMock.h"
+#include "Resource/SheetItem.h"
+#include "Resource/SheetManager.h"
+#include "Resource/SpriteSheet.h"
+#include "Texture.h"
+
+using namespace testing;
+
+namespace FA {
+
+namespace World {
+
+namespace {
+
+// Graphic objects read the backend when constructed, so this is set up before them
+class NullBackend
+{
+public:
+    NullBackend() { Graphic::SetRenderBackend(Graphic::RenderBackend::Null); }
+    ~NullBackend() { Graphic::SetRenderBackend(Graphic::RenderBackend::Sfml); }
+};
+
+}  // namespace
+
+class BackgroundChunksTest : public Test
+{
+protected:
+    BackgroundChunksTest()
+        : textureManager_([]() { return std::make_unique<Graphic::Texture>(); })
+        , levelCreator_(textureManager_, sheetManager_)
+    {
+        auto texture = std::make_unique<Graphic::Texture>();
+        texture->create(tileSize_, tileSize_);
+        auto id = textureManager_.Add("tiles", std::move(texture));
+        sheetManager_.AddSheet("tiles", std::make_unique<Shared::SpriteSheet>(id, sf::Vector2u(tileSize_, tileSize_),
+                                                                              sf::Vector2u(1, 1)));
+    }
+
+    // One tile in every other chunk of the first row, so a view centered on a tile only renders that chunk
+    std::unique_ptr<BackgroundChunks> MakeChunks(std::size_t budget)
+    {
+        auto chunks = std::make_unique<BackgroundChunks>(levelCreator_, sf::Vector2u(tileSize_, tileSize_), chunkSize_,
+                                                         budget);
+        std::vector<TileMap::TileData> layer;
+        for (int column = 0; column < 10; column += 2) {
+            TileMap::TileData data;
+            data.position_ = {static_cast<float>(column * chunkSize_), 0.0f};
+            data.graphic_.image_ = Shared::ImageData(Shared::SheetItem{"tiles", {0, 0}});
+            layer.push_back(data);
+        }
+        chunks->AddLayer(layer);
+
+        return chunks;
+    }
+
+    sf::FloatRect ViewOfColumn(int column) const
+    {
+        float size = static_cast<float>(chunkSize_);
+        return {column * size + size / 2.0f, size / 2.0f, 0.0f, 0.0f};
+    }
+
+    const unsigned int tileSize_ = 16;
+    const unsigned int chunkSize_ = 32;
+    NullBackend nullBackend_;
+    NiceMock<Shared::LoggerMock> loggerMock_;
+    Shared::TextureManager textureManager_;
+    Shared::SheetManager sheetManager_;
+    LevelCreator levelCreator_;
+    NiceMock<Graphic::RenderTargetMock> renderTargetMock_;
+};
+
+TEST_F(BackgroundChunksTest, LeastRecentlyUsedChunkShouldBeEvictedFirst)
+{
+    auto chunks = MakeChunks(2);
+
+    chunks->DrawTo(renderTargetMock_, ViewOfColumn(0));
+    chunks->DrawTo(renderTargetMock_, ViewOfColumn(2));
+    chunks->DrawTo(renderTargetMock_, ViewOfColumn(0));
+    chunks->DrawTo(renderTargetMock_, ViewOfColumn(4));
+
+    EXPECT_EQ(chunks->GetRenderedCount(), 2u);
+    EXPECT_TRUE(chunks->IsRendered(0, 0));
+    EXPECT_FALSE(chunks->IsRendered(0, 2));
+    EXPECT_TRUE(chunks->IsRendered(0, 4));
+}
+
+TEST_F(BackgroundChunksTest, ChunksUsedThisFrameShouldBeKeptOverBudget)
+{
+    auto chunks = MakeChunks(1);
+    float size = static_cast<float>(chunkSize_);
+
+    EXPECT_CALL(renderTargetMock_, draw(_)).Times(3);
+    chunks->DrawTo(renderTargetMock_, {0.0f, 0.0f, 5 * size, size});
+
+    EXPECT_EQ(chunks->GetRenderedCount(), 3u);
+    EXPECT_TRUE(chunks->IsRendered(0, 0));
+    EXPECT_TRUE(chunks->IsRendered(0, 2));
+    EXPECT_TRUE(chunks->IsRendered(0, 4));
+}
+
+TEST_F(BackgroundChunksTest, ExcessShouldBeReleasedAtEndOfFrame)
+{
+    auto chunks = MakeChunks(1);
+    float size = static_cast<float>(chunkSize_);
+    chunks->DrawTo(renderTargetMock_, {0.0f, 0.0f, 5 * size, size});
+
+    chunks->DrawTo(renderTargetMock_, ViewOfColumn(8));
+
+    EXPECT_EQ(chunks->GetRenderedCount(), 1u);
+    EXPECT_TRUE(chunks->IsRendered(0, 8));
+}
+
+TEST_F(BackgroundChunksTest, ZeroBudgetShouldOnlyKeepChunksOfTheFrame)
+{
+    auto chunks = MakeChunks(0);
+
+    chunks->DrawTo(renderTargetMock_, ViewOfColumn(0));
+    EXPECT_EQ(chunks->GetRenderedCount(), 1u);
+
+    chunks->DrawTo(renderTargetMock_, ViewOfColumn(2));
+    EXPECT_EQ(chunks->GetRenderedCount(), 1u);
+    EXPECT_TRUE(chunks->IsRendered(0, 2));
+}
+
+}  // namespace World
+
+}  // namespace FA